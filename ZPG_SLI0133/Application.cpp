@@ -8,7 +8,18 @@
 #include "TransformationComposite.h"
 #include "Material.h"
 #include "TextureLoader.h" 
+#include "ProgramBinaryCache.h"
+#include "ShaderLibrary.h"
+#include "HeadlessContext.h"
+#include "OffscreenTarget.h"
+#include "DynamicResolution.h"
+#include "InputRecorder.h"
+#include "LightStorage.h"
+#include "Profiler.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
 #include <stdexcept>
+#include <fstream>
 #include <glm/glm.hpp> 
 #include <vector>
 #include <iostream>
@@ -68,11 +79,81 @@ static void scroll_callback_adapter(GLFWwindow* w, double x, double y) {
     if (app) app->getController()->onScroll(x, y);
 }
 
-Application::Application(int width, int height, const std::string& title)
-    : m_RandomEngine(static_cast<unsigned int>(std::time(nullptr)))
+Application::Application(int width, int height, const std::string& title, const RunOptions& options)
+    : window(nullptr),
+    m_Options(options)
 {
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    unsigned int seed = m_Options.hasSeed ? m_Options.seed : static_cast<unsigned int>(std::time(nullptr));
+    if (!m_Options.replayPath.empty()) {
+        // Prehrani musi zacit ve stejne scene se stejnym RNG jako zaznam
+        m_Recorder = std::make_unique<InputRecorder>(InputRecorder::Mode::Replay, m_Options.replayPath);
+        seed = m_Recorder->getSeed();
+        m_Options.scene = m_Recorder->getScene();
+    }
+    else if (!m_Options.recordPath.empty()) {
+        m_Recorder = std::make_unique<InputRecorder>(InputRecorder::Mode::Record, m_Options.recordPath);
+        m_Recorder->setSeed(seed);
+        m_Recorder->setScene(m_Options.scene);
+    }
+    std::srand(seed);
+    m_RandomEngine.seed(seed);
+
+    if (m_Options.headless) {
+        m_Headless = std::make_unique<HeadlessContext>();
+        // Bez okna: controller nema co cist, zustava jen kvuli spolecnemu rozhrani
+        m_InputController = std::make_unique<InputController>(*this, nullptr, width / 2.0f, height / 2.0f);
+    }
+    else {
+        createWindow(width, height, title);
+    }
+    m_InputController->setRecorder(m_Recorder.get());
+
+    GLenum glewStatus = glewInit();
+#if defined(ZPG_HEADLESS_EGL) && defined(GLEW_ERROR_NO_GLX_DISPLAY)
+    // GLEW bez GLEW_EGL hleda GLX display; GL funkce se pres EGL kontext nactou i tak
+    if (m_Options.headless && glewStatus == GLEW_ERROR_NO_GLX_DISPLAY) glewStatus = GLEW_OK;
+#endif
+    if (glewStatus != GLEW_OK)
+        throw std::runtime_error("Failed to initialize GLEW");
+
+    ShaderLibrary::get().initParallelCompile();
+    GpuProfiler::get().setPerDrawEnabled(m_Options.gpuDrawZones);
+    RenderStats::get().setReportInterval(m_Options.statsInterval);
+    if (!m_Options.metricsPath.empty() && !RenderStats::get().openMetricsFile(m_Options.metricsPath)) {
+        std::cerr << "Cannot write render metrics: " << m_Options.metricsPath << std::endl;
+    }
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+    glFrontFace(GL_CCW);
+    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
+    glViewport(0, 0, width, height);
+
+    if (m_Options.headless) {
+        m_Offscreen = std::make_unique<OffscreenTarget>(width, height);
+        m_Offscreen->bind();
+    }
+    if (m_Options.dynamicResTarget > 0.0) {
+        DynamicResolution::Settings settings;
+        settings.targetGpuTime = m_Options.dynamicResTarget * 1e-3;
+        settings.minScale = m_Options.dynamicResMinScale;
+        // Okno muze mit framebuffer jinak velky nez okno (HiDPI)
+        int outputWidth = width, outputHeight = height;
+        if (window) glfwGetFramebufferSize(window, &outputWidth, &outputHeight);
+        m_DynamicResolution = std::make_unique<DynamicResolution>(outputWidth, outputHeight, settings);
+    }
+
+    setupScenes();
+    // Vychozi je Scene 2 (Solar System); benchmark si sceny nacita sam
+    if (!m_Options.benchmark) {
+        loadScene(m_Options.scene);
+    }
 
+    m_Render = std::make_unique<Render>(*this);
+}
+
+void Application::createWindow(int width, int height, const std::string& title) {
     if (!glfwInit())
         throw std::runtime_error("Failed to initialize GLFW");
 
@@ -94,36 +175,109 @@ Application::Application(int width, int height, const std::string& title)
     glfwSetWindowUserPointer(window, this);
 
     glfwSetFramebufferSizeCallback(window, size_callback);
+    glfwSetWindowRefreshCallback(window, refresh_callback);
     glfwSetKeyCallback(window, key_callback_adapter);
     glfwSetMouseButtonCallback(window, mouse_button_callback_adapter);
     glfwSetCursorPosCallback(window, cursor_position_callback_adapter);
     glfwSetScrollCallback(window, scroll_callback_adapter);
+}
 
-    if (glewInit() != GLEW_OK)
-        throw std::runtime_error("Failed to initialize GLEW");
+Application::~Application() {
+    // GL objekty sceny a sdilene programy musi zmizet driv nez kontext
+    scene.reset();
+    ShaderLibrary::get().clear();
+    GpuProfiler::get().clear();
+    m_DynamicResolution.reset();
+    m_Offscreen.reset();
+    if (m_Headless) {
+        m_Headless.reset();
+    }
+    else {
+        glfwTerminate();
+    }
+}
 
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
-    glCullFace(GL_BACK);
-    glFrontFace(GL_CCW);
-    glEnable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
-    glViewport(0, 0, width, height);
+const char* const Application::DEFAULT_TRACE_PATH = "zpg_trace.json";
 
-    setupScenes();
-    // Start with Scene 2 (Solar System)
-    loadScene(2);
+void Application::start() {
+    if (m_Render && m_Options.benchmark) {
+        runBenchmarks();
+    }
+    else if (m_Render) {
+        m_Render->run();
+    }
 
-    m_Render = std::make_unique<Render>(*this);
+    if (!m_Options.tracePath.empty()) {
+        writeTrace();
+    }
 }
 
-Application::~Application() {
-    glfwTerminate();
+void Application::writeTrace() const {
+    if (!Profiler::isEnabled()) {
+        std::cerr << "Profiler je vypnuty (ZPG_PROFILE=0), trace se nezapise" << std::endl;
+        return;
+    }
+    const std::string path = m_Options.tracePath.empty() ? DEFAULT_TRACE_PATH : m_Options.tracePath;
+    if (Profiler::get().writeChromeTrace(path)) {
+        std::cout << "Profiler trace: " << path << std::endl;
+    }
+    else {
+        std::cerr << "Cannot write profiler trace: " << path << std::endl;
+    }
 }
 
-void Application::start() {
-    if (m_Render) {
+void Application::runBenchmarks() {
+    // Zakladni konfigurace a pak kazdy sweep zvlast; ostatni parametry zustanou ze zakladu
+    std::vector<std::pair<std::string, BenchmarkParams>> configs;
+    configs.push_back(std::make_pair(std::string("base"), m_Options.benchParams));
+    for (const BenchmarkSweep& sweep : m_Options.benchSweeps) {
+        for (int value : sweep.values) {
+            BenchmarkParams params = m_Options.benchParams;
+            params.set(sweep.param, value);
+            configs.push_back(std::make_pair(sweep.param, params));
+        }
+    }
+
+    std::ofstream csv(m_Options.benchCsv);
+    if (!csv) {
+        throw std::runtime_error("Cannot write benchmark results: " + m_Options.benchCsv);
+    }
+    const std::vector<std::string>& keys = BenchmarkParams::getKeys();
+    csv << "sweep";
+    for (const std::string& key : keys) csv << "," << key;
+    csv << ",frames,cpu_avg_ms,cpu_p50_ms,cpu_p95_ms,cpu_p99_ms,update_avg_ms,render_avg_ms,present_avg_ms"
+        << ",gpu_samples,gpu_avg_ms,gpu_p50_ms,gpu_p95_ms\n";
+
+    for (size_t i = 0; i < configs.size(); ++i) {
+        if (window && glfwWindowShouldClose(window)) break;
+
+        const BenchmarkParams& params = configs[i].second;
+        std::cout << "Benchmark " << (i + 1) << "/" << configs.size() << " [" << configs[i].first << "]:";
+        for (const std::string& key : keys) std::cout << " " << key << "=" << params.get(key);
+        std::cout << std::endl;
+
+        loadBenchmarkScene(params);
         m_Render->run();
+
+        const FrameStatistics& stats = m_Render->getStatistics();
+        const FrameStatistics::Summary frame = stats.getFrameSummary();
+        const FrameStatistics::Summary gpu = stats.getGpuSummary();
+
+        csv << configs[i].first;
+        for (const std::string& key : keys) csv << "," << params.get(key);
+        csv << "," << stats.getFrameCount()
+            << "," << frame.avg * 1000.0 << "," << frame.p50 * 1000.0
+            << "," << frame.p95 * 1000.0 << "," << frame.p99 * 1000.0
+            << "," << stats.getPhaseSummary(PHASE_UPDATE).avg * 1000.0
+            << "," << stats.getPhaseSummary(PHASE_RENDER).avg * 1000.0
+            << "," << stats.getPhaseSummary(PHASE_PRESENT).avg * 1000.0
+            << "," << stats.getGpuSampleCount()
+            << "," << gpu.avg * 1000.0 << "," << gpu.p50 * 1000.0 << "," << gpu.p95 * 1000.0 << "\n";
+        // Radek hned na disk, pri padu dalsi konfigurace zustanou hotove vysledky
+        csv.flush();
     }
+
+    std::cout << "Benchmark results: " << m_Options.benchCsv << std::endl;
 }
 
 void Application::error_callback(int error, const char* description) {
@@ -133,12 +287,20 @@ void Application::error_callback(int error, const char* description) {
 void Application::size_callback(GLFWwindow* window, int width, int height) {
     glViewport(0, 0, width, height);
     Application* app = static_cast<Application*>(glfwGetWindowUserPointer(window));
+    if (app) app->requestRedraw();
+    if (app && app->m_DynamicResolution) {
+        app->m_DynamicResolution->resize(width, height);
+    }
     if (app && app->scene && height > 0) {
         app->scene->getCamera().setAspectRatio((float)width, (float)height);
-        app->scene->getCamera().updateMatrices();
     }
 }
 
+void Application::refresh_callback(GLFWwindow* window) {
+    Application* app = static_cast<Application*>(glfwGetWindowUserPointer(window));
+    if (app) app->requestRedraw();
+}
+
 void Application::setupScenes() {
     sceneInitializers.push_back([this](Scene* s) { setupScene0(s); });
     sceneInitializers.push_back([this](Scene* s) { setupScene1(s); });
@@ -149,34 +311,55 @@ void Application::setupScenes() {
 
 void Application::loadScene(int index) {
     if (index >= 0 && index < sceneInitializers.size()) {
-        scene = std::make_unique<Scene>();
+        activateScene(index, sceneInitializers[index]);
+    }
+}
 
-        if (index == 3 || index == 4) {
-            scene->createShaders("basic_vertexShader.vert", "basic_Blinn_fragmentShader.frag");
-        }
-        else {
-            scene->createShaders("basic_vertexShader.vert", "basic_Blinn_fragmentShader.frag");
-        }
+void Application::loadBenchmarkScene(const BenchmarkParams& params) {
+    activateScene(BENCHMARK_SCENE, [this, params](Scene* s) { setupBenchmarkScene(s, params); });
+}
+
+void Application::activateScene(int index, const std::function<void(Scene*)>& initializer) {
+    scene = std::make_unique<Scene>();
+
+    if (index == 3 || index == 4) {
+        scene->createShaders("basic_vertexShader.vert", "basic_Blinn_fragmentShader.frag");
+    }
+    else {
+        scene->createShaders("basic_vertexShader.vert", "basic_Blinn_fragmentShader.frag");
+    }
 
-        sceneInitializers[index](scene.get());
-        currentScene = index;
-        std::cout << "Nactena scena: " << index << std::endl;
+    initializer(scene.get());
+    scene->prewarmShaders();
+    currentScene = index;
+    std::cout << "Nactena scena: " << index << std::endl;
+
+    if (m_Options.statsInterval > 0.0) {
+        const SceneArena::Stats& arena = scene->getArenaStats();
+        std::cout << "Scene arena: " << arena.bytesUsed / 1024 << " KB used / "
+            << arena.bytesReserved / 1024 << " KB reserved, " << arena.chunks << " chunks, "
+            << arena.allocations << " allocations (" << arena.recycledAllocations << " recycled)" << std::endl;
     }
+
+    const ProgramBinaryCache::Stats& programCache = ProgramBinaryCache::getStats();
+    std::cout << "Program binary cache: " << programCache.hits << " hits, " << programCache.misses
+        << " misses, " << programCache.rejected << " rejected; "
+        << ShaderLibrary::get().getProgramCount() << " shared programs" << std::endl;
 }
 
 void Application::setupScene0(Scene* s) {
     s->setAmbientLight(glm::vec3(0.1f, 0.1f, 0.1f));
     s->addDirLight(glm::vec3(-0.5f, -0.5f, -0.5f), glm::vec3(1.0f, 1.0f, 1.0f));
-    auto triMaterial = std::make_shared<Material>();
+    auto triMaterial = s->createMaterial();
     triMaterial->diffuse = glm::vec3(1.0f, 0.0f, 0.0f);
     triMaterial->ambient = glm::vec3(1.0f, 0.0f, 0.0f);
     triMaterial->specular = glm::vec3(0.5f, 0.5f, 0.5f);
     triMaterial->shininess = 32.0f;
     s->addObject(TEST_TRIANGLE, TEST_TRIANGLE_SIZE, 8);
-    DrawableObject* obj = s->getFirstObject();
+    DrawableObject obj = s->getFirstObject();
     if (obj) {
-        obj->setMaterial(triMaterial);
-        obj->getTransformation().translate(glm::vec3(0.0f, 1.0f, 0.0f));
+        obj.setMaterial(triMaterial);
+        obj.getTransformation().translate(glm::vec3(0.0f, 1.0f, 0.0f));
     }
 }
 
@@ -184,48 +367,47 @@ void Application::setupScene1(Scene* scene) {
     scene->clearObjects();
     scene->InitSkybox();
     scene->setAmbientLight(glm::vec3(0.1f, 0.1f, 0.1f));
-    auto sphereMaterial = std::make_shared<Material>();
+    auto sphereMaterial = scene->createMaterial();
     sphereMaterial->diffuse = glm::vec3(0.9f, 0.9f, 0.9f);
     sphereMaterial->ambient = glm::vec3(0.9f, 0.9f, 0.9f);
     sphereMaterial->specular = glm::vec3(1.0f, 1.0f, 1.0f);
     sphereMaterial->shininess = 64.0f;
-    auto lightBulbMaterial = std::make_shared<Material>();
+    auto lightBulbMaterial = scene->createMaterial();
     lightBulbMaterial->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     const float OBJECT_RADIUS = 1.0f;
     const float OBJECT_OFFSET = 1.5f;
     const float OBJECT_Y_POS = 0.0f;
     const glm::vec3 LIGHT_POS(0.0f, 3.0f, 0.0f);
     scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-    DrawableObject* s1 = scene->getObject(scene->getObjectCount() - 1);
-    s1->setMaterial(sphereMaterial);
-    s1->getTransformation().scale(glm::vec3(OBJECT_RADIUS));
-    s1->getTransformation().translate(glm::vec3(-OBJECT_OFFSET, OBJECT_Y_POS, OBJECT_OFFSET));
+    DrawableObject s1 = scene->getObject(scene->getObjectCount() - 1);
+    s1.setMaterial(sphereMaterial);
+    s1.getTransformation().scale(glm::vec3(OBJECT_RADIUS));
+    s1.getTransformation().translate(glm::vec3(-OBJECT_OFFSET, OBJECT_Y_POS, OBJECT_OFFSET));
     scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-    DrawableObject* s2 = scene->getObject(scene->getObjectCount() - 1);
-    s2->setMaterial(sphereMaterial);
-    s2->getTransformation().scale(glm::vec3(OBJECT_RADIUS));
-    s2->getTransformation().translate(glm::vec3(OBJECT_OFFSET, OBJECT_Y_POS, OBJECT_OFFSET));
+    DrawableObject s2 = scene->getObject(scene->getObjectCount() - 1);
+    s2.setMaterial(sphereMaterial);
+    s2.getTransformation().scale(glm::vec3(OBJECT_RADIUS));
+    s2.getTransformation().translate(glm::vec3(OBJECT_OFFSET, OBJECT_Y_POS, OBJECT_OFFSET));
     scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-    DrawableObject* s3 = scene->getObject(scene->getObjectCount() - 1);
-    s3->setMaterial(sphereMaterial);
-    s3->getTransformation().scale(glm::vec3(OBJECT_RADIUS));
-    s3->getTransformation().translate(glm::vec3(-OBJECT_OFFSET, OBJECT_Y_POS, -OBJECT_OFFSET));
+    DrawableObject s3 = scene->getObject(scene->getObjectCount() - 1);
+    s3.setMaterial(sphereMaterial);
+    s3.getTransformation().scale(glm::vec3(OBJECT_RADIUS));
+    s3.getTransformation().translate(glm::vec3(-OBJECT_OFFSET, OBJECT_Y_POS, -OBJECT_OFFSET));
     scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-    DrawableObject* s4 = scene->getObject(scene->getObjectCount() - 1);
-    s4->setMaterial(sphereMaterial);
-    s4->getTransformation().scale(glm::vec3(OBJECT_RADIUS));
-    s4->getTransformation().translate(glm::vec3(OBJECT_OFFSET, OBJECT_Y_POS, -OBJECT_OFFSET));
+    DrawableObject s4 = scene->getObject(scene->getObjectCount() - 1);
+    s4.setMaterial(sphereMaterial);
+    s4.getTransformation().scale(glm::vec3(OBJECT_RADIUS));
+    s4.getTransformation().translate(glm::vec3(OBJECT_OFFSET, OBJECT_Y_POS, -OBJECT_OFFSET));
     scene->addPointLight(LIGHT_POS, glm::vec3(1.0f, 1.0f, 1.0f), 1.0f, 0.09f, 0.032f);
     scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-    DrawableObject* lightBulb = scene->getObject(scene->getObjectCount() - 1);
-    lightBulb->setMaterial(lightBulbMaterial);
-    lightBulb->setUnlit(true);
-    lightBulb->getTransformation().scale(glm::vec3(0.15f));
-    lightBulb->getTransformation().translate(LIGHT_POS);
+    DrawableObject lightBulb = scene->getObject(scene->getObjectCount() - 1);
+    lightBulb.setMaterial(lightBulbMaterial);
+    lightBulb.setUnlit(true);
+    lightBulb.getTransformation().scale(glm::vec3(0.15f));
+    lightBulb.getTransformation().translate(LIGHT_POS);
     scene->getCamera().setPosition(glm::vec3(0.0f, 10.0f, 0.0f));
     scene->getCamera().setFi(glm::radians(0.0f));
     scene->getCamera().setAlpha(glm::radians(-90.0f));
-    scene->getCamera().updateMatrices();
 }
 
 extern float earthOrbitAngle;
@@ -252,54 +434,54 @@ void Application::setupScene2(Scene* scene) {
 
     // Alpha = -30 stupnu (kouka sikmo dolu na rovinu orbit)
     scene->getCamera().setAlpha(glm::radians(-30.0f));
-
-    scene->getCamera().updateMatrices();
 }
 
 void Application::setupScene3(Scene* scene) {
     scene->clearObjects();
+    scene->setDepthPrepass(true); // husty les, hodne prekryvu
+    scene->setRenderPath(RenderPath::Deferred); // svetlusky: hodne bodovych svetel
 
     // Naètení textur a materiálù
-    auto mat_grass = std::make_shared<Material>();
+    auto mat_grass = scene->createMaterial();
     mat_grass->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_grass->specular = glm::vec3(0.0f, 0.0f, 0.0f);
     mat_grass->shininess = 16.0f;
     mat_grass->diffuseTextureID = TextureLoader::LoadTexture("assets/multipletexture/grass.png");
 
-    auto mat_swamp = std::make_shared<Material>();
+    auto mat_swamp = scene->createMaterial();
     mat_swamp->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_swamp->specular = glm::vec3(0.2f, 0.2f, 0.1f);
     mat_swamp->shininess = 8.0f;
     mat_swamp->diffuseTextureID = TextureLoader::LoadTexture("assets/multipletexture/mud.jpg");
 
-    auto mat_shrek = std::make_shared<Material>();
+    auto mat_shrek = scene->createMaterial();
     mat_shrek->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_shrek->specular = glm::vec3(0.1f, 0.1f, 0.1f);
     mat_shrek->shininess = 32.0f;
     mat_shrek->diffuseTextureID = TextureLoader::LoadTexture("assets/shrek/shrek.png");
 
-    auto mat_fiona = std::make_shared<Material>();
+    auto mat_fiona = scene->createMaterial();
     mat_fiona->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_fiona->specular = glm::vec3(0.1f, 0.1f, 0.1f);
     mat_fiona->shininess = 32.0f;
     mat_fiona->diffuseTextureID = TextureLoader::LoadTexture("assets/shrek/fiona.png");
 
-    auto mat_toilet = std::make_shared<Material>();
+    auto mat_toilet = scene->createMaterial();
     mat_toilet->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_toilet->specular = glm::vec3(0.8f, 0.8f, 0.8f);
     mat_toilet->shininess = 128.0f;
     mat_toilet->diffuseTextureID = TextureLoader::LoadTexture("assets/shrek/toiled.jpg");
 
-    auto mat_tree = std::make_shared<Material>();
+    auto mat_tree = scene->createMaterial();
     mat_tree->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
     mat_tree->ambient = glm::vec3(0.1f, 0.4f, 0.1f);
     mat_tree->specular = glm::vec3(0.1f, 0.1f, 0.1f);
     mat_tree->shininess = 16.0f;
 
-    auto mat_firefly_body = std::make_shared<Material>();
+    auto mat_firefly_body = scene->createMaterial();
     mat_firefly_body->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
 
-    auto mat_skydome = std::make_shared<Material>();
+    auto mat_skydome = scene->createMaterial();
     mat_skydome->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_skydome->diffuseTextureID = TextureLoader::LoadTexture("assets/sky/skydome.png");
 
@@ -311,44 +493,44 @@ void Application::setupScene3(Scene* scene) {
     const float treeScale = 0.5f;
 
     scene->addObject(plain, sizeof(plain), 8);
-    DrawableObject* ground = scene->getObject(scene->getObjectCount() - 1);
-    ground->setMaterial(mat_grass);
-    ground->getTransformation().scale(glm::vec3(sceneSize / 2.0f));
+    DrawableObject ground = scene->getObject(scene->getObjectCount() - 1);
+    ground.setMaterial(mat_grass);
+    ground.getTransformation().scale(glm::vec3(sceneSize / 2.0f));
 
     scene->addObject(plain, sizeof(plain), 8);
-    DrawableObject* swamp = scene->getObject(scene->getObjectCount() - 1);
-    swamp->setMaterial(mat_swamp);
-    swamp->getTransformation()
+    DrawableObject swamp = scene->getObject(scene->getObjectCount() - 1);
+    swamp.setMaterial(mat_swamp);
+    swamp.getTransformation()
         .scale(glm::vec3(swampSize / 2.0f))
         .translate(glm::vec3(0.0f, 0.01f, 0.0f));
 
     scene->addObject("assets/shrek/shrek.obj");
-    DrawableObject* shrek = scene->getObject(scene->getObjectCount() - 1);
-    shrek->setMaterial(mat_shrek);
-    shrek->getTransformation()
+    DrawableObject shrek = scene->getObject(scene->getObjectCount() - 1);
+    shrek.setMaterial(mat_shrek);
+    shrek.getTransformation()
         .translate(glm::vec3(-1.0f, 0.02f, 0.0f))
         .scale(glm::vec3(0.5f))
         .addMatrix20();//Transformation 
 
     scene->addObject("assets/shrek/fiona.obj");
-    DrawableObject* fiona = scene->getObject(scene->getObjectCount() - 1);
-    fiona->setMaterial(mat_fiona);
-    fiona->getTransformation()
+    DrawableObject fiona = scene->getObject(scene->getObjectCount() - 1);
+    fiona.setMaterial(mat_fiona);
+    fiona.getTransformation()
         .translate(glm::vec3(1.0f, 0.02f, 0.0f))
         .scale(glm::vec3(0.5f));
 
     scene->addObject("assets/shrek/toiled.obj");
-    DrawableObject* toilet = scene->getObject(scene->getObjectCount() - 1);
-    toilet->setMaterial(mat_toilet);
-    toilet->getTransformation()
+    DrawableObject toilet = scene->getObject(scene->getObjectCount() - 1);
+    toilet.setMaterial(mat_toilet);
+    toilet.getTransformation()
         .translate(glm::vec3(0.0f, 0.02f, 0.0f))
         .scale(glm::vec3(0.5f));
 
     scene->addObject("assets/sky/skydome.obj");
-    DrawableObject* skydome = scene->getObject(scene->getObjectCount() - 1);
-    skydome->setMaterial(mat_skydome);
-    skydome->setUnlit(true);
-    skydome->getTransformation().scale(glm::vec3(sceneSize * 0.8f));
+    DrawableObject skydome = scene->getObject(scene->getObjectCount() - 1);
+    skydome.setMaterial(mat_skydome);
+    skydome.setUnlit(true);
+    skydome.getTransformation().scale(glm::vec3(sceneSize * 0.8f));
 
     const int numTrees = 150;
     std::uniform_real_distribution<float> randPos(-sceneSize / 2.0f, sceneSize / 2.0f);
@@ -362,9 +544,9 @@ void Application::setupScene3(Scene* scene) {
         }
 
         scene->addObject(tree, TREE_DATA_SIZE, 6);
-        DrawableObject* treeObj = scene->getObject(scene->getObjectCount() - 1);
-        treeObj->setMaterial(mat_tree);
-        treeObj->getTransformation()
+        DrawableObject treeObj = scene->getObject(scene->getObjectCount() - 1);
+        treeObj.setMaterial(mat_tree);
+        treeObj.getTransformation()
             .translate(glm::vec3(x, 0.0f, z))
             .scale(glm::vec3(treeScale));
     }
@@ -390,9 +572,9 @@ void Application::setupScene3(Scene* scene) {
         scene->addFirefly(glm::vec3(x, y, z), fireflyLightColor, con, lin, quad);
 
         scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-        DrawableObject* fireflyBody = scene->getObject(scene->getObjectCount() - 1);
-        fireflyBody->setMaterial(mat_firefly_body);
-        fireflyBody->setUnlit(true);
+        DrawableObject fireflyBody = scene->getObject(scene->getObjectCount() - 1);
+        fireflyBody.setMaterial(mat_firefly_body);
+        fireflyBody.setUnlit(true);
         scene->addFireflyBody(fireflyBody);
     }
 
@@ -401,26 +583,30 @@ void Application::setupScene3(Scene* scene) {
 
 void Application::setupScene4(Scene* scene) {
     scene->clearObjects();
+    scene->setDepthPrepass(true); // husty les, hodne prekryvu
     scene->initGameMaterials();
 
-    std::string nick;
-    std::cout << "\n========================================" << std::endl;
-    std::cout << "Zadejte svuj NICK pro start hry: ";
-    std::cin >> nick;
-    scene->setPlayerName(nick);
-    std::cout << "========================================\n" << std::endl;
+    // Headless beh ani prehravani nesmi cekat na konzoli, zustane vychozi jmeno
+    if (!m_Options.headless && m_Options.replayPath.empty()) {
+        std::string nick;
+        std::cout << "\n========================================" << std::endl;
+        std::cout << "Zadejte svuj NICK pro start hry: ";
+        std::cin >> nick;
+        scene->setPlayerName(nick);
+        std::cout << "========================================\n" << std::endl;
+    }
 
-    auto mat_grass = std::make_shared<Material>();
+    auto mat_grass = scene->createMaterial();
     mat_grass->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_grass->specular = glm::vec3(0.0f, 0.0f, 0.0f);
     mat_grass->shininess = 16.0f;
     mat_grass->diffuseTextureID = TextureLoader::LoadTexture("assets/multipletexture/grass.png");
 
-    auto mat_skydome = std::make_shared<Material>();
+    auto mat_skydome = scene->createMaterial();
     mat_skydome->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
     mat_skydome->diffuseTextureID = TextureLoader::LoadTexture("assets/sky/skydome.png");
 
-    auto mat_firefly = std::make_shared<Material>();
+    auto mat_firefly = scene->createMaterial();
     mat_firefly->diffuse = glm::vec3(1.0f, 1.0f, 0.5f);
 
     scene->setAmbientLight(glm::vec3(0.15f, 0.15f, 0.25f));
@@ -429,15 +615,15 @@ void Application::setupScene4(Scene* scene) {
     const float sceneSize = 80.0f;
 
     scene->addObject(plain, sizeof(plain), 8);
-    DrawableObject* ground = scene->getObject(scene->getObjectCount() - 1);
-    ground->setMaterial(mat_grass);
-    ground->getTransformation().scale(glm::vec3(sceneSize));
+    DrawableObject ground = scene->getObject(scene->getObjectCount() - 1);
+    ground.setMaterial(mat_grass);
+    ground.getTransformation().scale(glm::vec3(sceneSize));
 
     scene->addObject("assets/sky/skydome.obj");
-    DrawableObject* skydome = scene->getObject(scene->getObjectCount() - 1);
-    skydome->setMaterial(mat_skydome);
-    skydome->setUnlit(true);
-    skydome->getTransformation().scale(glm::vec3(sceneSize * 1.2f));
+    DrawableObject skydome = scene->getObject(scene->getObjectCount() - 1);
+    skydome.setMaterial(mat_skydome);
+    skydome.setUnlit(true);
+    skydome.getTransformation().scale(glm::vec3(sceneSize * 1.2f));
 
     scene->initForest();
 
@@ -450,10 +636,10 @@ void Application::setupScene4(Scene* scene) {
         scene->addFirefly(glm::vec3(x, y, z), glm::vec3(1.0f, 0.8f, 0.2f), 1.0f, 0.7f, 1.8f);
 
         scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
-        DrawableObject* ffBody = scene->getObject(scene->getObjectCount() - 1);
-        ffBody->setMaterial(mat_firefly);
-        ffBody->setUnlit(true);
-        ffBody->getTransformation().translate(glm::vec3(x, y, z)).scale(glm::vec3(0.15f));
+        DrawableObject ffBody = scene->getObject(scene->getObjectCount() - 1);
+        ffBody.setMaterial(mat_firefly);
+        ffBody.setUnlit(true);
+        ffBody.getTransformation().translate(glm::vec3(x, y, z)).scale(glm::vec3(0.15f));
 
         scene->addFireflyBody(ffBody);
     }
@@ -461,5 +647,139 @@ void Application::setupScene4(Scene* scene) {
     scene->getCamera().setPosition(glm::vec3(0.0f, 20.0f, 40.0f));
     scene->getCamera().setFi(glm::radians(-90.0f));
     scene->getCamera().setAlpha(glm::radians(-30.0f));
-    scene->getCamera().updateMatrices();
+}
+
+void Application::setupBenchmarkScene(Scene* scene, const BenchmarkParams& params) {
+    scene->clearObjects();
+    // Az po clearObjects: scena uz nema meshe klicovane adresami techto dat
+    m_BenchMeshData.clear();
+    scene->setDepthPrepass(true);
+    scene->setRenderPath(params.deferred ? RenderPath::Deferred : RenderPath::Forward);
+
+    scene->setAmbientLight(glm::vec3(0.1f, 0.1f, 0.12f));
+    scene->addDirLight(glm::vec3(-0.2f, -1.0f, -0.3f), glm::vec3(0.3f, 0.3f, 0.35f));
+
+    // Hustota zustava stejna, s poctem objektu roste plocha pole
+    const float spacing = 2.0f;
+    const int objectCount = params.trees + params.bushes;
+    const int cells = std::max(1, (int)std::ceil(std::sqrt((float)objectCount)));
+    const float fieldSize = std::max(20.0f, cells * spacing);
+    const float half = fieldSize / 2.0f;
+
+    auto mat_ground = scene->createMaterial();
+    mat_ground->diffuse = glm::vec3(0.2f, 0.35f, 0.15f);
+    mat_ground->ambient = glm::vec3(0.2f, 0.35f, 0.15f);
+    mat_ground->specular = glm::vec3(0.0f, 0.0f, 0.0f);
+    mat_ground->shininess = 16.0f;
+
+    scene->addObject(plain, sizeof(plain), 8);
+    DrawableObject ground = scene->getObject(scene->getObjectCount() - 1);
+    ground.setMaterial(mat_ground);
+    ground.getTransformation().scale(glm::vec3(half));
+
+    // Unikatni meshe: deformovane kopie stromu a kere
+    std::uniform_real_distribution<float> randUnit(0.0f, 1.0f);
+    m_BenchMeshData.reserve(params.meshes);
+    for (int m = 0; m < params.meshes; ++m) {
+        const bool fromTree = (m % 2) == 0;
+        const float* source = fromTree ? tree : bushes;
+        const size_t floats = (fromTree ? sizeof(tree) : sizeof(bushes)) / sizeof(float);
+
+        const float height = 0.7f + 0.6f * randUnit(m_RandomEngine);
+        const float width = 0.8f + 0.4f * randUnit(m_RandomEngine);
+        std::vector<float> data(source, source + floats);
+        for (size_t v = 0; v + 5 < floats; v += 6) {
+            data[v] *= width;
+            data[v + 1] *= height;
+            data[v + 2] *= width;
+        }
+        m_BenchMeshData.push_back(std::move(data));
+    }
+
+    std::vector<std::shared_ptr<Material>> materials;
+    for (int m = 0; m < params.materials; ++m) {
+        auto mat = scene->createMaterial();
+        glm::vec3 color(0.05f + 0.2f * randUnit(m_RandomEngine), 0.25f + 0.3f * randUnit(m_RandomEngine), 0.05f + 0.15f * randUnit(m_RandomEngine));
+        mat->diffuse = color;
+        mat->ambient = color;
+        mat->specular = glm::vec3(0.1f, 0.1f, 0.1f);
+        mat->shininess = 8.0f + 56.0f * randUnit(m_RandomEngine);
+        materials.push_back(mat);
+    }
+
+    auto mat_tree = scene->createMaterial();
+    mat_tree->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
+    mat_tree->ambient = glm::vec3(0.1f, 0.4f, 0.1f);
+    mat_tree->specular = glm::vec3(0.1f, 0.1f, 0.1f);
+    mat_tree->shininess = 16.0f;
+
+    auto mat_bush = scene->createMaterial();
+    mat_bush->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
+    mat_bush->ambient = glm::vec3(0.1f, 0.3f, 0.1f);
+    mat_bush->specular = glm::vec3(0.1f, 0.1f, 0.1f);
+    mat_bush->shininess = 16.0f;
+
+    std::uniform_real_distribution<float> randJitter(-0.4f * spacing, 0.4f * spacing);
+    for (int i = 0; i < objectCount; ++i) {
+        // Stromy a kere rovnomerne promichane v mrizce
+        const bool isTree = (long long)(i + 1) * params.trees / objectCount > (long long)i * params.trees / objectCount;
+
+        if (params.meshes > 0) {
+            const std::vector<float>& data = m_BenchMeshData[i % params.meshes];
+            scene->addObject(data.data(), data.size() * sizeof(float), 6);
+        }
+        else if (isTree) {
+            scene->addObject(tree, TREE_DATA_SIZE, 6);
+        }
+        else {
+            scene->addObject(bushes, BUSHES_DATA_SIZE, 6);
+        }
+
+        DrawableObject obj = scene->getObject(scene->getObjectCount() - 1);
+        if (params.materials > 0) obj.setMaterial(materials[i % params.materials]);
+        else obj.setMaterial(isTree ? mat_tree : mat_bush);
+
+        float x = -half + ((i % cells) + 0.5f) * spacing + randJitter(m_RandomEngine);
+        float z = -half + ((i / cells) + 0.5f) * spacing + randJitter(m_RandomEngine);
+        obj.getTransformation()
+            .translate(glm::vec3(x, 0.0f, z))
+            .scale(glm::vec3(isTree ? 0.5f : 0.5f + 0.5f * randUnit(m_RandomEngine)));
+    }
+
+    if (params.lights > LightBlock::MAX_POINT_LIGHTS) {
+        std::cerr << "Benchmark: " << params.lights << " point lights requested, shaders take "
+            << LightBlock::MAX_POINT_LIGHTS << std::endl;
+    }
+    const int lightCells = std::max(1, (int)std::ceil(std::sqrt((float)params.lights)));
+    const float lightSpacing = fieldSize / lightCells;
+    // Dosah ~ 0.75 roztece: c + q * r^2 = 51 (PointLight::getInfluenceRadius)
+    const float lightRadius = std::max(2.0f, 0.75f * lightSpacing);
+    const float quadratic = 50.0f / (lightRadius * lightRadius);
+    for (int i = 0; i < params.lights; ++i) {
+        glm::vec3 position(-half + ((i % lightCells) + 0.5f) * lightSpacing, 3.0f,
+            -half + ((i / lightCells) + 0.5f) * lightSpacing);
+        glm::vec3 color(0.5f + 0.5f * randUnit(m_RandomEngine), 0.5f + 0.5f * randUnit(m_RandomEngine), 0.3f + 0.4f * randUnit(m_RandomEngine));
+        scene->addPointLight(position, color, 1.0f, 0.0f, quadratic);
+    }
+
+    auto mat_target = scene->createMaterial();
+    mat_target->diffuse = glm::vec3(0.8f, 0.2f, 0.2f);
+    mat_target->ambient = glm::vec3(0.8f, 0.2f, 0.2f);
+
+    std::uniform_real_distribution<float> randPos(-half, half);
+    for (int i = 0; i < params.targets; ++i) {
+        scene->addObject(sphere, SPHERE_VERTICES_SIZE, 6);
+        DrawableObject target = scene->getObject(scene->getObjectCount() - 1);
+        target.setMaterial(mat_target);
+
+        glm::vec3 center(randPos(m_RandomEngine), 1.5f, randPos(m_RandomEngine));
+        float radius = 1.0f + 4.0f * randUnit(m_RandomEngine);
+        float speed = 0.5f + randUnit(m_RandomEngine);
+        scene->addOrbiter(target, center, radius, speed, 0.4f);
+    }
+
+    // Z okraje pole pres nej; vzdalene casti orizne far plane kamery
+    scene->getCamera().setPosition(glm::vec3(0.0f, 12.0f, std::min(half, 40.0f)));
+    scene->getCamera().setFi(glm::radians(-90.0f));
+    scene->getCamera().setAlpha(glm::radians(-20.0f));
 }
\ No newline at end of file
@@ -11,11 +11,43 @@
 #include <random> 
 #include "Scene.h" 
 #include "TransformationComposite.h"
+#include "BenchmarkParams.h"
 
 class Scene;
 class DrawableObject;
 class InputController;
 class Render;
+class HeadlessContext;
+class OffscreenTarget;
+class InputRecorder;
+class DynamicResolution;
+
+// Parametry behu z prikazove radky (main.cpp)
+struct RunOptions {
+    bool headless = false;    // EGL kontext bez okna, kresli se do OffscreenTarget
+    int frames = 0;           // po tolika snimcich konec, 0 = bez limitu
+    double duration = 0.0;    // po tolika sekundach konec, 0 = bez limitu
+    std::string frameLog;     // CSV s casy snimku; prazdne = jen souhrn na stdout
+    int scene = 2;
+    std::string recordPath;   // zaznam vstupu a delta casu (InputRecorder)
+    std::string replayPath;   // prehrani zaznamu; seed a scena jsou v nem
+    bool hasSeed = false;
+    unsigned int seed = 0;    // seed pro std::rand i m_RandomEngine
+    int warmupFrames = 0;     // snimky na zacatku behu, ktere se do statistiky nepocitaji
+    std::string tracePath;    // Chrome trace profileru pri ukonceni; F12 ho zapise kdykoli
+    bool gpuDrawZones = false; // CPU a GPU zona kolem kazdeho draw callu, ne jen kolem passu
+    double statsInterval = 0.0; // souhrn RenderStats na stdout kazdych N sekund, 0 = vypnuto
+    std::string metricsPath;  // souhrn RenderStats jako CSV misto stdout
+    double dynamicResTarget = 0.0; // cil GPU casu sceny [ms] pro DynamicResolution, 0 = vypnuto
+    float dynamicResMinScale = 0.5f;
+    bool onDemand = false;    // kreslit jen po zmene sceny, kamery nebo okna; jinak cekat na udalosti
+
+    // Scalability benchmark: zaklad + kazdy sweep zvlast, jeden radek CSV na konfiguraci
+    bool benchmark = false;
+    BenchmarkParams benchParams;
+    std::vector<BenchmarkSweep> benchSweeps;
+    std::string benchCsv = "bench_results.csv";
+};
 
 extern float rotationSpeed;
 extern float rotationAngle;
@@ -24,17 +56,26 @@ extern bool direction;
 class Application {
 private:
     GLFWwindow* window;
+    RunOptions m_Options;
+    std::unique_ptr<HeadlessContext> m_Headless;
+    std::unique_ptr<OffscreenTarget> m_Offscreen;
+    std::unique_ptr<DynamicResolution> m_DynamicResolution;
+    std::unique_ptr<InputRecorder> m_Recorder;
     std::unique_ptr<Scene> scene;
     std::unique_ptr<InputController> m_InputController;
     std::unique_ptr<Render> m_Render;
 
     std::vector<std::function<void(Scene*)>> sceneInitializers;
     int currentScene = -1;
+    bool m_RedrawRequested = true;
 
     std::mt19937 m_RandomEngine;
+    // Vrcholy vygenerovanych meshu; Scene si meshe cachuje podle adresy dat
+    std::vector<std::vector<float>> m_BenchMeshData;
 
 private:
     void setupScenes();
+    void createWindow(int width, int height, const std::string& title);
 
     void setupScene0(Scene* scene);
     void setupScene1(Scene* scene);
@@ -43,23 +84,48 @@ private:
     void setupScene4(Scene* scene);
     void setupScene5(Scene* scene);
     void setupScene6(Scene* scene);
+    void setupBenchmarkScene(Scene* scene, const BenchmarkParams& params);
+
+    void activateScene(int index, const std::function<void(Scene*)>& initializer);
+    void runBenchmarks();
 
     static void error_callback(int error, const char* description);
     static void size_callback(GLFWwindow* window, int width, int height);
+    static void refresh_callback(GLFWwindow* window);
 
 public:
     static const std::string DEFAULT_VERTEX_SHADER;
     static const std::string DEFAULT_FRAGMENT_SHADER;
+    static const char* const DEFAULT_TRACE_PATH;
 
-    Application(int width, int height, const std::string& title);
+    Application(int width, int height, const std::string& title, const RunOptions& options = RunOptions());
     ~Application();
 
     void start();
 
     Scene* getActiveScene() { return scene.get(); }
+    // V headless rezimu nullptr
     GLFWwindow* getWindow() { return window; }
+    const RunOptions& getOptions() const { return m_Options; }
+    bool isHeadless() const { return m_Options.headless; }
     InputController* getController() { return m_InputController.get(); }
+    InputRecorder* getRecorder() { return m_Recorder.get(); }
+    // Bez --dynamic-res nullptr
+    DynamicResolution* getDynamicResolution() { return m_DynamicResolution.get(); }
     int getCurrentSceneIndex() const { return currentScene; }
 
+    // Index aktivni sceny pri benchmarku (animace sceny 0-4 se nespousti)
+    static const int BENCHMARK_SCENE = 100;
+
     void loadScene(int index);
+    // Udalost okna (zmena velikosti, odkryti), po ktere se musi kreslit i staticka scena
+    void requestRedraw() { m_RedrawRequested = true; }
+    bool consumeRedrawRequest() {
+        bool requested = m_RedrawRequested;
+        m_RedrawRequested = false;
+        return requested;
+    }
+    // Zony profileru do --trace souboru, bez nej do DEFAULT_TRACE_PATH
+    void writeTrace() const;
+    void loadBenchmarkScene(const BenchmarkParams& params);
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include "BenchmarkParams.h"
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+static int parseCount(const std::string& key, const std::string& text) {
+    char* end = nullptr;
+    long value = std::strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0' || value < 0) {
+        throw std::runtime_error("Invalid benchmark value " + key + "=" + text);
+    }
+    return (int)value;
+}
+
+void BenchmarkParams::parse(const std::string& text) {
+    std::istringstream stream(text);
+    std::string pair;
+    while (std::getline(stream, pair, ',')) {
+        if (pair.empty()) continue;
+        size_t eq = pair.find('=');
+        if (eq == std::string::npos) {
+            throw std::runtime_error("Expected key=value in benchmark params: " + pair);
+        }
+        std::string key = pair.substr(0, eq);
+        set(key, parseCount(key, pair.substr(eq + 1)));
+    }
+}
+
+void BenchmarkParams::set(const std::string& key, int value) {
+    if (key == "trees") trees = value;
+    else if (key == "bushes") bushes = value;
+    else if (key == "lights") lights = value;
+    else if (key == "meshes") meshes = value;
+    else if (key == "materials") materials = value;
+    else if (key == "targets") targets = value;
+    else if (key == "deferred") deferred = value != 0;
+    else throw std::runtime_error("Unknown benchmark parameter: " + key);
+}
+
+int BenchmarkParams::get(const std::string& key) const {
+    if (key == "trees") return trees;
+    if (key == "bushes") return bushes;
+    if (key == "lights") return lights;
+    if (key == "meshes") return meshes;
+    if (key == "materials") return materials;
+    if (key == "targets") return targets;
+    if (key == "deferred") return deferred ? 1 : 0;
+    throw std::runtime_error("Unknown benchmark parameter: " + key);
+}
+
+const std::vector<std::string>& BenchmarkParams::getKeys() {
+    static const std::vector<std::string> keys = {
+        "trees", "bushes", "lights", "meshes", "materials", "targets", "deferred"
+    };
+    return keys;
+}
+
+BenchmarkSweep BenchmarkSweep::parse(const std::string& text) {
+    size_t eq = text.find('=');
+    if (eq == std::string::npos) {
+        throw std::runtime_error("Expected param=v1,v2,... in benchmark sweep: " + text);
+    }
+
+    BenchmarkSweep sweep;
+    sweep.param = text.substr(0, eq);
+    // Overi klic hned pri parsovani, ne az po nacteni prvni sceny
+    BenchmarkParams().get(sweep.param);
+
+    std::istringstream stream(text.substr(eq + 1));
+    std::string value;
+    while (std::getline(stream, value, ',')) {
+        sweep.values.push_back(parseCount(sweep.param, value));
+    }
+    if (sweep.values.empty()) {
+        throw std::runtime_error("Benchmark sweep without values: " + text);
+    }
+    return sweep;
+}
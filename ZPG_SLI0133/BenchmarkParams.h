@@ -0,0 +1,30 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// Parametry synteticke scalability sceny (Application::setupBenchmarkScene)
+struct BenchmarkParams {
+    int trees = 10000;
+    int bushes = 10000;
+    int lights = 16;     // bodova svetla v mrizce nad polem
+    int meshes = 0;      // 0 = vsechny stromy/kere sdili dva meshe
+    int materials = 0;   // 0 = sdileny material stromu a keru
+    int targets = 0;     // pohyblive objekty, transformace se meni kazdy krok
+    bool deferred = false;
+
+    // "trees=100000,lights=64"; neznamy klic nebo spatna hodnota = runtime_error
+    void parse(const std::string& text);
+    void set(const std::string& key, int value);
+    int get(const std::string& key) const;
+
+    static const std::vector<std::string>& getKeys();
+};
+
+// Jeden parametr probehnuty pres vice hodnot, ostatni zustanou ze zakladu
+struct BenchmarkSweep {
+    std::string param;
+    std::vector<int> values;
+
+    // "trees=1000,10000,100000"
+    static BenchmarkSweep parse(const std::string& text);
+};
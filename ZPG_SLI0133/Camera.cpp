@@ -14,9 +14,12 @@ Camera::Camera(glm::vec3 startPosition)
     fov(glm::radians(45.0f)),
     nearPlane(0.1f),
     farPlane(100.0f),
-    aspectRatio(4.0f / 3.0f)
+    aspectRatio(4.0f / 3.0f),
+    viewDirty(true),
+    projectionDirty(true),
+    changed(true)
 {
-    updateMatrices();
+    flush();
 }
 
 void Camera::attach(ICameraObserver* observer) {
@@ -35,7 +38,23 @@ void Camera::notifyObservers() const {
     }
 }
 
-void Camera::updateMatrices() {
+void Camera::flush() {
+    if (!viewDirty && !projectionDirty) return;
+
+    if (viewDirty) {
+        updateView();
+    }
+    if (projectionDirty) {
+        projectionMatrix = glm::perspective(fov, aspectRatio, nearPlane, farPlane);
+    }
+    viewDirty = false;
+    projectionDirty = false;
+    changed = true;
+
+    notifyObservers();
+}
+
+void Camera::updateView() {
     target.x = cos(fi) * cos(alpha);
     target.y = sin(alpha);
     target.z = sin(fi) * cos(alpha);
@@ -46,14 +65,19 @@ void Camera::updateMatrices() {
     up = glm::normalize(glm::cross(right, target));
 
     viewMatrix = glm::lookAt(position, position + target, up);
-
-    projectionMatrix = glm::perspective(fov, aspectRatio, nearPlane, farPlane);
-
-    notifyObservers();
 }
 
 void Camera::setAspectRatio(float width, float height) {
-    if (height > 0.001f) {
+    if (height > 0.001f && width / height != aspectRatio) {
         aspectRatio = width / height;
+        projectionDirty = true;
+    }
+}
+
+void Camera::setPlanes(float newNear, float newFar) {
+    if (newNear != nearPlane || newFar != farPlane) {
+        nearPlane = newNear;
+        farPlane = newFar;
+        projectionDirty = true;
     }
 }
\ No newline at end of file
@@ -29,32 +29,58 @@ private:
     float farPlane;
     float aspectRatio;
 
+    // Settery jen oznaci, co je treba prepocitat; matice a observery az ve flush()
+    bool viewDirty;
+    bool projectionDirty;
+    bool changed;
+
     void notifyObservers() const;
+    void updateView();
 
 public:
     Camera(glm::vec3 startPosition);
 
     void attach(ICameraObserver* observer);
     void detach(ICameraObserver* observer);
-    void updateMatrices();
-
-    void setPosition(const glm::vec3& newPos) { position = newPos; }
+    // Prepocita zmenene matice a jednou upozorni observery. Render::run jednou za snimek
+    // po zpracovani vstupu, takze vic udalosti mysi za snimek stoji jeden prepocet.
+    void flush();
+    bool isDirty() const { return viewDirty || projectionDirty; }
+    // On-demand kresleni: flush() neco prepocital od posledniho dotazu
+    bool consumeChanged() {
+        bool wasChanged = changed;
+        changed = false;
+        return wasChanged;
+    }
+
+    void setPosition(const glm::vec3& newPos) {
+        if (newPos != position) { position = newPos; viewDirty = true; }
+    }
     const glm::vec3& getPosition() const { return position; }
 
     const glm::vec3& getFrontVector() const { return target; }
     const glm::vec3& getRightVector() const { return right; }
     const glm::vec3& getUpVector() const { return up; }
 
-    void setAlpha(float newAlpha) { alpha = newAlpha; }
+    void setAlpha(float newAlpha) {
+        if (newAlpha != alpha) { alpha = newAlpha; viewDirty = true; }
+    }
     float getAlpha() const { return alpha; }
 
-    void setFi(float newFi) { fi = newFi; }
+    void setFi(float newFi) {
+        if (newFi != fi) { fi = newFi; viewDirty = true; }
+    }
     float getFi() const { return fi; }
 
-    void setFOV(float newFov) { fov = newFov; }
+    void setFOV(float newFov) {
+        if (newFov != fov) { fov = newFov; projectionDirty = true; }
+    }
     float getFOV() const { return fov; }
+    float getNearPlane() const { return nearPlane; }
+    float getFarPlane() const { return farPlane; }
 
     void setAspectRatio(float width, float height);
+    void setPlanes(float newNear, float newFar);
 
     const glm::mat4& getViewMatrix() const { return viewMatrix; }
     const glm::mat4& getProjectionMatrix() const { return projectionMatrix; }
@@ -16,7 +16,6 @@ void CameraController::processMouseMovement(float xoffset, float yoffset, GLbool
 
     camera.setFi(fi);
     camera.setAlpha(alpha);
-    camera.updateMatrices();
 }
 
 void CameraController::processScroll(float yoffset) {
@@ -27,7 +26,6 @@ void CameraController::processScroll(float yoffset) {
     }
 
     camera.setFOV(fov);
-    camera.updateMatrices();
 }
 
 void CameraController::processKeyboard(Movement direction, float velocity) {
@@ -52,5 +50,4 @@ void CameraController::processKeyboard(Movement direction, float velocity) {
     }
 
     camera.setPosition(position);
-    camera.updateMatrices();
 }
\ No newline at end of file
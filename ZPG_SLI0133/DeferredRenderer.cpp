@@ -0,0 +1,247 @@
+#include "DeferredRenderer.h"
+#include "ShaderProgram.h"
+#include "ShaderLibrary.h"
+#include "Model.h"
+#include "Camera.h"
+#include "LightStorage.h"
+#include "RenderStats.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/constants.hpp>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+// Nizkopolygonova koule pro objemy bodovych svetel (pozice + normala, stride 6)
+static std::vector<float> buildLightVolume(int rings, int segments) {
+    std::vector<float> vertices;
+    const float pi = glm::pi<float>();
+    // Koule je vepsana, vrcholy se posunou ven, aby objem pokryl cely dosah
+    const float inflate = 1.0f / std::cos(pi / (float)segments);
+
+    auto point = [&](int ring, int segment) {
+        float theta = pi * (float)ring / (float)rings;
+        float phi = 2.0f * pi * (float)segment / (float)segments;
+        return glm::vec3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+    };
+    auto push = [&](const glm::vec3& p) {
+        glm::vec3 v = p * inflate;
+        vertices.insert(vertices.end(), { v.x, v.y, v.z, p.x, p.y, p.z });
+    };
+
+    for (int ring = 0; ring < rings; ++ring) {
+        for (int segment = 0; segment < segments; ++segment) {
+            glm::vec3 a = point(ring, segment);
+            glm::vec3 b = point(ring + 1, segment);
+            glm::vec3 c = point(ring + 1, segment + 1);
+            glm::vec3 d = point(ring, segment + 1);
+            // CCW pri pohledu zvenku
+            push(a); push(d); push(c);
+            push(a); push(c); push(b);
+        }
+    }
+    return vertices;
+}
+
+DeferredRenderer::DeferredRenderer()
+    : m_GeometryVariants("basic_vertexShader.vert", "deferred_gbuffer.frag"),
+    m_LightingVariants("deferred_fullscreen.vert", "deferred_lighting.frag") {
+    m_PointLightProgram = ShaderLibrary::get().getProgram("depth_prepass.vert", "deferred_pointlight.frag",
+        LightStorage::getBlockDefines());
+
+    std::vector<float> sphere = buildLightVolume(8, 12);
+    m_LightVolume = std::make_unique<Model>(sphere.data(), sphere.size() * sizeof(float), 6);
+
+    // Core profil vyzaduje navazany VAO i pro kresleni bez atributu
+    glGenVertexArrays(1, &m_EmptyVAO);
+}
+
+DeferredRenderer::~DeferredRenderer() {
+    destroyTargets();
+    if (m_EmptyVAO != 0) {
+        glDeleteVertexArrays(1, &m_EmptyVAO);
+    }
+}
+
+// RGBA8 albedo + RGBA16F normala/specular + D24S8
+static const int64_t GBUFFER_BYTES_PER_PIXEL = 4 + 8 + 4;
+
+void DeferredRenderer::destroyTargets() {
+    if (m_FBO != 0) {
+        glDeleteFramebuffers(1, &m_FBO);
+        RenderStats::get().addTextureMemory(-(int64_t)m_Width * m_Height * GBUFFER_BYTES_PER_PIXEL);
+    }
+    if (m_AlbedoTexture != 0) glDeleteTextures(1, &m_AlbedoTexture);
+    if (m_NormalSpecularTexture != 0) glDeleteTextures(1, &m_NormalSpecularTexture);
+    if (m_DepthStencilTexture != 0) glDeleteTextures(1, &m_DepthStencilTexture);
+    m_FBO = m_AlbedoTexture = m_NormalSpecularTexture = m_DepthStencilTexture = 0;
+}
+
+static GLuint createTarget(GLint internalFormat, int width, int height, GLenum format, GLenum type) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return texture;
+}
+
+void DeferredRenderer::resize(int width, int height) {
+    if (width == m_Width && height == m_Height && m_FBO != 0) return;
+    if (width <= 0 || height <= 0) return;
+
+    destroyTargets();
+    m_Width = width;
+    m_Height = height;
+
+    GLint outputFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &outputFBO);
+
+    m_AlbedoTexture = createTarget(GL_RGBA8, width, height, GL_RGBA, GL_UNSIGNED_BYTE);
+    m_NormalSpecularTexture = createTarget(GL_RGBA16F, width, height, GL_RGBA, GL_HALF_FLOAT);
+    m_DepthStencilTexture = createTarget(GL_DEPTH24_STENCIL8, width, height, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    RenderStats::get().addTextureMemory((int64_t)width * height * GBUFFER_BYTES_PER_PIXEL);
+
+    glGenFramebuffers(1, &m_FBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_AlbedoTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, m_NormalSpecularTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthStencilTexture, 0);
+
+    const GLenum drawBuffers[] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, drawBuffers);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)outputFBO);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "G-buffer incomplete: 0x" << std::hex << status << std::dec << std::endl;
+        throw std::runtime_error("Deferred G-buffer creation failed.");
+    }
+}
+
+void DeferredRenderer::beginGeometryPass() {
+    // Cil nemusi byt okno (headless OffscreenTarget), vysledek jde tam, kde se kreslilo
+    GLint outputFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &outputFBO);
+    m_OutputFBO = (GLuint)outputFBO;
+    glGetIntegerv(GL_VIEWPORT, m_Viewport);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+}
+
+void DeferredRenderer::endGeometryPass() {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_FBO);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_OutputFBO);
+    const GLint x0 = m_Viewport[0], y0 = m_Viewport[1];
+    const GLint x1 = x0 + m_Viewport[2], y1 = y0 + m_Viewport[3];
+    glBlitFramebuffer(x0, y0, x1, y1, x0, y0, x1, y1, GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_OutputFBO);
+}
+
+ShaderProgram& DeferredRenderer::getGeometryProgram(uint8_t objectFeatures) {
+    ShaderVariantKey key;
+    key.features = objectFeatures & (SHADER_UNLIT | SHADER_TEXTURED);
+    return m_GeometryVariants.get(key);
+}
+
+ShaderVariantKey DeferredRenderer::fullscreenKey(const ShaderVariantKey& lightingKey) {
+    // Bodova svetla jdou pres objemy, ve fullscreen passu nejsou
+    ShaderVariantKey key = lightingKey;
+    key.features &= SHADER_FLASHLIGHT;
+    key.pointLights = 0;
+    return key;
+}
+
+void DeferredRenderer::prewarm(uint8_t objectFeatures, const ShaderVariantKey& lightingKey) {
+    ShaderVariantKey geometryKey;
+    geometryKey.features = objectFeatures & (SHADER_UNLIT | SHADER_TEXTURED);
+    m_GeometryVariants.prewarm(geometryKey);
+    m_LightingVariants.prewarm(fullscreenKey(lightingKey));
+}
+
+void DeferredRenderer::bindGBufferTextures(ShaderProgram& program) const {
+    program.setInt("u_GAlbedo", 0);
+    program.setInt("u_GNormalSpecular", 1);
+    program.setInt("u_GDepth", 2);
+    // G-buffer muze byt vetsi nez viewport, pozice se rekonstruuje z viewportu
+    program.setVec4("u_Viewport", glm::vec4((float)m_Viewport[0], (float)m_Viewport[1], (float)m_Viewport[2], (float)m_Viewport[3]));
+}
+
+void DeferredRenderer::lightingPass(const Camera& camera, const ShaderVariantKey& lightingKey, const LightStorage& lights) {
+    const glm::mat4 viewProjection = camera.getProjectionMatrix() * camera.getViewMatrix();
+    const glm::mat4 inverseViewProjection = glm::inverse(viewProjection);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_AlbedoTexture);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, m_NormalSpecularTexture);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, m_DepthStencilTexture);
+    RenderStats::get().countTextureBind(3);
+
+    // Pozadi odmita readGBuffer podle hloubky; stencil nese ID objektu jen v 8 bitech
+    // (ID 256, 512, ... = 0), pokryti z nej urcit nejde. Osvetleni se scita.
+    glDisable(GL_DEPTH_TEST);
+    glDepthMask(GL_FALSE);
+    glStencilMask(0x00);
+    glStencilFunc(GL_ALWAYS, 0, 0xFF);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+
+    // 1) Ambient, smerova svetla, reflektory, baterka
+    ShaderProgram& fullscreen = m_LightingVariants.get(fullscreenKey(lightingKey));
+    fullscreen.use();
+    bindGBufferTextures(fullscreen);
+    fullscreen.setMat4("u_InverseViewProjection", inverseViewProjection);
+    fullscreen.setVec3("u_ViewPos", camera.getPosition());
+
+    glBindVertexArray(m_EmptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    RenderStats::get().countVaoBind();
+    RenderStats::get().countDraw(GL_TRIANGLES, 3);
+    glBindVertexArray(0);
+
+    // 2) Bodova svetla jako objemy; zadni steny, aby fungovaly i s kamerou uvnitr
+    ShaderProgram& pointProgram = *m_PointLightProgram;
+    pointProgram.use();
+    bindGBufferTextures(pointProgram);
+    pointProgram.setMat4("u_InverseViewProjection", inverseViewProjection);
+    pointProgram.setVec3("u_ViewPos", camera.getPosition());
+    pointProgram.setMat4("u_ViewMatrix", camera.getViewMatrix());
+    pointProgram.setMat4("u_ProjectionMatrix", camera.getProjectionMatrix());
+
+    glCullFace(GL_FRONT);
+    m_LightVolumeCount = 0;
+    const std::vector<PointLight>& pointLights = lights.getPointLights();
+    const int pointCount = lights.getPointLightCount();
+    for (int i = 0; i < pointCount; ++i) {
+        const PointLight& pointLight = pointLights[i];
+        float radius = pointLight.getInfluenceRadius();
+        if (radius <= 0.0f) continue;
+
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), pointLight.position);
+        model = glm::scale(model, glm::vec3(radius));
+
+        pointProgram.setMat4("u_ModelMatrix", model);
+        pointProgram.setInt("u_PointLightIndex", i);
+        m_LightVolume->draw();
+        m_LightVolumeCount++;
+    }
+    glCullFace(GL_BACK);
+
+    glDisable(GL_BLEND);
+    glStencilMask(0xFF);
+    glDepthMask(GL_TRUE);
+    glEnable(GL_DEPTH_TEST);
+    glUseProgram(0);
+
+    for (int unit = 2; unit >= 0; --unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include "SceneArena.h"
+#include "ShaderVariantManager.h"
+
+class ShaderProgram;
+class Model;
+class Camera;
+class LightStorage;
+struct SpotLight;
+
+// Deferred shading: geometry pass do G-bufferu, pak osvetleni v obrazovem prostoru.
+// Smerova svetla, reflektory a baterka v jednom fullscreen passu, bodova svetla
+// jako koule o polomeru dosahu -> cena svetel nezavisi na slozitosti geometrie.
+//
+// G-buffer: RGBA8 albedo + ambient, RGBA16F oct normala + shininess + specular,
+// D24S8 hloubka (stencil nese ID objektu pro picking).
+class DeferredRenderer {
+public:
+    DeferredRenderer();
+    ~DeferredRenderer();
+
+    DeferredRenderer(const DeferredRenderer&) = delete;
+    DeferredRenderer& operator=(const DeferredRenderer&) = delete;
+
+    // Zalozi / zmeni G-buffer podle velikosti vystupu; kresli se jen do aktualniho
+    // viewportu, ktery muze byt mensi (dynamicke rozliseni)
+    void resize(int width, int height);
+
+    // Prevezme vystupni framebuffer a viewport z aktualniho stavu
+    void beginGeometryPass();
+    // Prenese hloubku a stencil do vystupniho framebufferu (skybox, picking)
+    void endGeometryPass();
+
+    // Program geometry passu podle vlastnosti objektu (SHADER_UNLIT, SHADER_TEXTURED)
+    ShaderProgram& getGeometryProgram(uint8_t objectFeatures);
+
+    // Svetla cte z uniform bloku, LightStorage::upload() musi probehnout predem
+    void lightingPass(const Camera& camera, const ShaderVariantKey& lightingKey, const LightStorage& lights);
+
+    void prewarm(uint8_t objectFeatures, const ShaderVariantKey& lightingKey);
+
+    size_t getLightVolumeCount() const { return m_LightVolumeCount; }
+
+private:
+    void destroyTargets();
+    void bindGBufferTextures(ShaderProgram& program) const;
+    static ShaderVariantKey fullscreenKey(const ShaderVariantKey& lightingKey);
+
+    GLuint m_FBO = 0;
+    GLuint m_OutputFBO = 0;
+    GLuint m_AlbedoTexture = 0;
+    GLuint m_NormalSpecularTexture = 0;
+    GLuint m_DepthStencilTexture = 0;
+    GLuint m_EmptyVAO = 0;
+    int m_Width = 0;
+    int m_Height = 0;
+    GLint m_Viewport[4] = {};
+
+    ShaderVariantManager m_GeometryVariants;
+    ShaderVariantManager m_LightingVariants;
+    std::shared_ptr<ShaderProgram> m_PointLightProgram;
+    std::unique_ptr<Model> m_LightVolume;
+    size_t m_LightVolumeCount = 0;
+};
@@ -1,11 +1,14 @@
 #pragma once
-#include "Light.h"
+#include <glm/glm.hpp>
 
-class DirLight : public Light {
-public:
+// std140 rozlozeni (viz LightBlock v shaderech), pole jde do UBO jednim memcpy
+struct DirLight {
     glm::vec3 direction;
+    float _pad0;
+    glm::vec3 color;
+    float _pad1;
 
     DirLight(const glm::vec3& dir, const glm::vec3& col)
-        : Light(col), direction(dir) {
+        : direction(dir), _pad0(0.0f), color(col), _pad1(0.0f) {
     }
 };
\ No newline at end of file
@@ -1,54 +1,40 @@
 #include "DrawableObject.h"
-#include "Model.h"
-#include "ShaderProgram.h"
+#include "ObjectStorage.h"
 #include "TransformationComposite.h"
-#include <glm/gtc/matrix_transform.hpp>
-#include <iostream>
+#include "ShaderVariantManager.h"
+#include "Material.h"
+#include <stdexcept>
 
-DrawableObject::DrawableObject(std::unique_ptr<Model> m, std::shared_ptr<ShaderProgram> s)
-    : model(std::move(m)), shaderProgram(std::move(s)) {
-    transformation = std::make_unique<TransformationComposite>();
-    m_Material = std::make_shared<Material>();
+DrawableObject::DrawableObject(ObjectStorage& storage, unsigned int id)
+    : m_Storage(&storage), m_ID(id) {
 }
 
-void DrawableObject::draw() const {
-    if (!shaderProgram) {
-        std::cerr << "ERROR: ShaderProgram in not initialized for DrawableObject." << std::endl;
-        return;
-    }
-    if (!m_Material) {
-        std::cerr << "ERROR: Material neni nastaven pro DrawableObject." << std::endl;
-        return;
-    }
-
-    shaderProgram->use();
-    shaderProgram->setBool("u_IsUnlit", this->isUnlit);
-
-    shaderProgram->setMaterial(*m_Material);
-
-    if (m_Material->diffuseTextureID != 0) {
-        shaderProgram->setBool("u_HasDiffuseTexture", true);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, m_Material->diffuseTextureID);
-    }
-    else {
-        shaderProgram->setBool("u_HasDiffuseTexture", false);
+size_t DrawableObject::index() const {
+    uint32_t i = m_Storage ? m_Storage->indexOf(m_ID) : ObjectStorage::INVALID_INDEX;
+    if (i == ObjectStorage::INVALID_INDEX) {
+        throw std::runtime_error("DrawableObject handle does not refer to a live object.");
     }
+    return i;
+}
 
-    glm::mat4 modelMatrix = transformation->getMatrix();
-    shaderProgram->setMat4("u_ModelMatrix", modelMatrix);
-    shaderProgram->setMat4("u_ViewMatrix", shaderProgram->getViewMatrix());
-    shaderProgram->setMat4("u_ProjectionMatrix", shaderProgram->getProjectionMatrix());
+bool DrawableObject::isValid() const {
+    return m_Storage && m_Storage->indexOf(m_ID) != ObjectStorage::INVALID_INDEX;
+}
 
-    model->draw();
+TransformationComposite& DrawableObject::getTransformation() const {
+    return m_Storage->getTransformation(index());
+}
 
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glUseProgram(0);
+void DrawableObject::setMaterial(const std::shared_ptr<Material>& material) const {
+    m_Storage->setMaterial(index(), m_Storage->addMaterial(material));
 }
 
-TransformationComposite& DrawableObject::getTransformation() {
-    return *transformation;
+void DrawableObject::setUnlit(bool unlit) const {
+    m_Storage->setFlag(index(), OBJECT_UNLIT, unlit);
 }
 
-DrawableObject::~DrawableObject() {
+uint8_t DrawableObject::getShaderFeatures() const {
+    size_t i = index();
+    const Material& material = m_Storage->getMaterial(m_Storage->getMaterialHandle(i));
+    return ShaderVariantKey::objectFeatures(material, (m_Storage->getFlags(i) & OBJECT_UNLIT) != 0);
 }
\ No newline at end of file
@@ -1,34 +1,37 @@
 #pragma once
 #include <memory>
+#include <cstdint>
 #include <glm/glm.hpp>
-#include "Model.h"          
-#include "ShaderProgram.h"  
-#include "Material.h" 
 
-class Model;
-class ShaderProgram;
+class ObjectStorage;
 class TransformationComposite;
+struct Material;
 
+// Lehky handle na objekt ulozeny v ObjectStorage sceny.
+// Data objektu (transformace, material, mesh) lezi v souvislych polich storage.
 class DrawableObject {
 private:
-    std::unique_ptr<Model> model;
-    std::unique_ptr<TransformationComposite> transformation;
-    std::shared_ptr<ShaderProgram> shaderProgram;
-
-    std::shared_ptr<Material> m_Material;
-    bool isUnlit = false;
+    ObjectStorage* m_Storage = nullptr;
     unsigned int m_ID = 0;
 
+    size_t index() const;
+
 public:
-    DrawableObject(std::unique_ptr<Model> m, std::shared_ptr<ShaderProgram> s);
-    ~DrawableObject();
+    DrawableObject() = default;
+    DrawableObject(ObjectStorage& storage, unsigned int id);
+
+    bool isValid() const;
+    explicit operator bool() const { return isValid(); }
+
+    // Reference do ObjectStorage: neuchovavat, po create()/destroy() jineho objektu
+    // muze ukazovat jinam
+    TransformationComposite& getTransformation() const;
 
-    void draw() const;
-    TransformationComposite& getTransformation();
+    void setMaterial(const std::shared_ptr<Material>& material) const;
+    void setUnlit(bool unlit) const;
 
-    void setMaterial(std::shared_ptr<Material> material) { m_Material = material; }
-    void setUnlit(bool unlit) { isUnlit = unlit; }
+    // Vlastnosti varianty shaderu dane materialem a priznaky objektu (ShaderFeature)
+    uint8_t getShaderFeatures() const;
 
-    void setID(unsigned int id) { m_ID = id; }
     unsigned int getID() const { return m_ID; }
 };
\ No newline at end of file
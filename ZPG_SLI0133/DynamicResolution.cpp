@@ -0,0 +1,78 @@
+#include "DynamicResolution.h"
+#include "SampleCounter.h"
+#include <algorithm>
+#include <cmath>
+
+constexpr float DynamicResolution::SCALE_STEP;
+constexpr double DynamicResolution::HYSTERESIS;
+constexpr double DynamicResolution::SMOOTHING;
+const int DynamicResolution::SAMPLES_PER_DECISION;
+
+DynamicResolution::DynamicResolution(int outputWidth, int outputHeight, const Settings& settings)
+    : m_Settings(settings), m_OutputWidth(0), m_OutputHeight(0), m_Scale(settings.maxScale) {
+    m_Settings.minScale = std::min(std::max(m_Settings.minScale, SCALE_STEP), m_Settings.maxScale);
+    resize(outputWidth, outputHeight);
+}
+
+void DynamicResolution::resize(int outputWidth, int outputHeight) {
+    if (outputWidth <= 0 || outputHeight <= 0) return;
+    if (outputWidth == m_OutputWidth && outputHeight == m_OutputHeight) return;
+
+    m_Target.reset();
+    m_Target.reset(new OffscreenTarget(outputWidth, outputHeight));
+    m_OutputWidth = outputWidth;
+    m_OutputHeight = outputHeight;
+}
+
+int DynamicResolution::scaled(int size) const {
+    return std::max((int)(size * m_Scale + 0.5f), 1);
+}
+
+void DynamicResolution::begin() {
+    // Vystup nemusi byt okno (headless OffscreenTarget)
+    GLint outputFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &outputFBO);
+    m_OutputFBO = (GLuint)outputFBO;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Target->getFBO());
+    glViewport(0, 0, getRenderWidth(), getRenderHeight());
+}
+
+void DynamicResolution::end() {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_Target->getFBO());
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_OutputFBO);
+    glBlitFramebuffer(0, 0, getRenderWidth(), getRenderHeight(), 0, 0, m_OutputWidth, m_OutputHeight,
+        GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_OutputFBO);
+    glViewport(0, 0, m_OutputWidth, m_OutputHeight);
+}
+
+void DynamicResolution::addGpuTime(double seconds) {
+    if (m_StaleSamples > 0) {
+        m_StaleSamples--;
+        return;
+    }
+    m_SmoothedTime = m_Samples == 0 ? seconds : m_SmoothedTime + (seconds - m_SmoothedTime) * SMOOTHING;
+    if (++m_Samples < SAMPLES_PER_DECISION) return;
+
+    // Cas sceny roste zhruba s poctem pixelu, tedy s druhou mocninou meritka
+    const double target = m_Settings.targetGpuTime;
+    float scale = m_Scale;
+    if (m_SmoothedTime > target * (1.0 + HYSTERESIS)) {
+        float wanted = m_Scale * (float)std::sqrt(target / m_SmoothedTime);
+        scale = std::min(std::floor(wanted / SCALE_STEP + 0.001f) * SCALE_STEP, m_Scale - SCALE_STEP);
+    }
+    else if (m_Scale < m_Settings.maxScale) {
+        // Nahoru jen o krok, a jen kdyz se tam cas jeste vejde; jinak by meritko kmitalo
+        float next = std::round(m_Scale / SCALE_STEP + 1.0f) * SCALE_STEP;
+        double ratio = (double)next / m_Scale;
+        if (m_SmoothedTime * ratio * ratio < target) scale = next;
+    }
+    scale = std::min(std::max(scale, m_Settings.minScale), m_Settings.maxScale);
+
+    if (scale != m_Scale) {
+        m_Scale = scale;
+        m_Samples = 0;
+        m_StaleSamples = SampleCounter::QUERY_COUNT;
+    }
+}
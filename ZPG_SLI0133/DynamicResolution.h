@@ -0,0 +1,65 @@
+#pragma once
+#include <GL/glew.h>
+#include <memory>
+#include "OffscreenTarget.h"
+
+// Scena se kresli do OffscreenTarget v mensim rozliseni a na konci snimku se
+// roztahne (GL_LINEAR blit) do vystupniho framebufferu (okno, headless target).
+// Meritko ridi GPU cas sceny vuci cili: zmena az po nekolika vzorcich a jen mimo
+// pasmo hystereze, po krocich SCALE_STEP. Target ma velikost vystupu, mensi
+// rozliseni je jen mensi viewport, zmena meritka tedy nic nealokuje.
+class DynamicResolution {
+public:
+    struct Settings {
+        double targetGpuTime = 1.0 / 60.0; // GPU cas sceny [s]
+        float minScale = 0.5f;
+        float maxScale = 1.0f;
+    };
+
+    static constexpr float SCALE_STEP = 0.05f;
+    // Zmensuje se nad target * (1 + HYSTERESIS); zvetsuje se jen kdyz odhad casu
+    // po zvetseni zustane pod targetem
+    static constexpr double HYSTERESIS = 0.05;
+    static constexpr double SMOOTHING = 0.2;
+    // Vysledky GPU dotazu jsou o par snimku starsi; po zmene se prvnich
+    // SampleCounter::QUERY_COUNT zahodi (jeste ze stareho meritka)
+    static const int SAMPLES_PER_DECISION = 8;
+
+    DynamicResolution(int outputWidth, int outputHeight, const Settings& settings);
+
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    // Zmena velikosti okna; 0 (minimalizace) se ignoruje
+    void resize(int outputWidth, int outputHeight);
+
+    // Pred kreslenim sceny: navaze target a zmenseny viewport
+    void begin();
+    // Po kresleni sceny: blit do framebufferu navazaneho pri begin()
+    void end();
+
+    // GPU cas sceny jednoho snimku [s] (SampleCounter s GL_TIME_ELAPSED)
+    void addGpuTime(double seconds);
+
+    float getScale() const { return m_Scale; }
+    int getOutputWidth() const { return m_OutputWidth; }
+    int getOutputHeight() const { return m_OutputHeight; }
+    int getRenderWidth() const { return scaled(m_OutputWidth); }
+    int getRenderHeight() const { return scaled(m_OutputHeight); }
+    // Picking cte stencil a hloubku odsud, vystup ma jen barvu
+    GLuint getFBO() const { return m_Target->getFBO(); }
+
+private:
+    int scaled(int size) const;
+
+    Settings m_Settings;
+    std::unique_ptr<OffscreenTarget> m_Target;
+    int m_OutputWidth;
+    int m_OutputHeight;
+    GLuint m_OutputFBO = 0;
+    float m_Scale;
+
+    double m_SmoothedTime = 0.0;
+    int m_Samples = 0;
+    int m_StaleSamples = 0;
+};
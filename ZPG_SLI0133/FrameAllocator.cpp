@@ -0,0 +1,86 @@
+#include "FrameAllocator.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+FrameAllocator& FrameAllocator::get() {
+    static FrameAllocator instance;
+    return instance;
+}
+
+FrameAllocator::FrameAllocator(size_t capacity) {
+    for (Buffer& buffer : m_Buffers) {
+        buffer.memory = std::make_unique<unsigned char[]>(capacity);
+        buffer.capacity = capacity;
+    }
+}
+
+void FrameAllocator::beginFrame() {
+    m_FrameIndex++;
+    m_Current ^= 1;
+    resetBuffer(m_Buffers[m_Current]);
+}
+
+void FrameAllocator::resetBuffer(Buffer& buffer) {
+    // Co se v tomto bufferu alokovalo pred dvema snimky, uz musi byt uvolnene
+    assert(buffer.liveAllocations == 0 && "frame allocation escaped its frame");
+
+    // Pri preteceni buffer zvetsime, aby se dalsi snimky vesly bez heapu
+    if (buffer.overflowBytes > 0) {
+        size_t newCapacity = std::max(buffer.capacity * 2, buffer.used + buffer.overflowBytes);
+        std::cerr << "FrameAllocator: overflow of " << buffer.overflowBytes
+            << " bytes, growing to " << newCapacity << " bytes" << std::endl;
+        buffer.memory = std::make_unique<unsigned char[]>(newCapacity);
+        buffer.capacity = newCapacity;
+        buffer.overflow.clear();
+        buffer.overflowBytes = 0;
+    }
+
+#ifndef NDEBUG
+    std::memset(buffer.memory.get(), 0xCD, buffer.used);
+#endif
+    buffer.used = 0;
+    buffer.liveAllocations = 0;
+}
+
+void* FrameAllocator::allocate(size_t size, size_t alignment) {
+    Buffer& buffer = m_Buffers[m_Current];
+    buffer.liveAllocations++;
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(buffer.memory.get());
+    uintptr_t aligned = (base + buffer.used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    size_t offset = aligned - base;
+
+    if (offset + size <= buffer.capacity) {
+        buffer.used = offset + size;
+        m_PeakBytes = std::max(m_PeakBytes, buffer.used);
+        return buffer.memory.get() + offset;
+    }
+
+    buffer.overflow.emplace_back(std::make_unique<unsigned char[]>(size + alignment), size + alignment);
+    buffer.overflowBytes += size + alignment;
+    uintptr_t block = reinterpret_cast<uintptr_t>(buffer.overflow.back().first.get());
+    return reinterpret_cast<void*>((block + alignment - 1) & ~(uintptr_t)(alignment - 1));
+}
+
+void FrameAllocator::deallocate(void* ptr, size_t) {
+    if (Buffer* buffer = findOwner(ptr)) {
+        assert(buffer->liveAllocations > 0);
+        buffer->liveAllocations--;
+    }
+}
+
+FrameAllocator::Buffer* FrameAllocator::findOwner(void* ptr) {
+    unsigned char* p = static_cast<unsigned char*>(ptr);
+    for (Buffer& buffer : m_Buffers) {
+        if (p >= buffer.memory.get() && p < buffer.memory.get() + buffer.capacity) {
+            return &buffer;
+        }
+        for (const auto& block : buffer.overflow) {
+            if (p >= block.first.get() && p < block.first.get() + block.second) {
+                return &buffer;
+            }
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Linearni alokator pro docasna data jednoho snimku. Ma dva buffery:
+// pamet ze snimku N plati jeste behem snimku N+1, pak se buffer prepise.
+class FrameAllocator {
+public:
+    static FrameAllocator& get();
+
+    explicit FrameAllocator(size_t capacity = 1024 * 1024);
+
+    // Volat jednou na zacatku snimku (Render::run)
+    void beginFrame();
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    void deallocate(void* ptr, size_t size);
+
+    uint64_t getFrameIndex() const { return m_FrameIndex; }
+    size_t getBytesUsed() const { return m_Buffers[m_Current].used; }
+    size_t getPeakBytes() const { return m_PeakBytes; }
+
+private:
+    struct Buffer {
+        std::unique_ptr<unsigned char[]> memory;
+        size_t capacity = 0;
+        size_t used = 0;
+        size_t overflowBytes = 0;
+        size_t liveAllocations = 0;
+        std::vector<std::pair<std::unique_ptr<unsigned char[]>, size_t>> overflow;
+    };
+
+    void resetBuffer(Buffer& buffer);
+    Buffer* findOwner(void* ptr);
+
+    Buffer m_Buffers[2];
+    int m_Current = 0;
+    uint64_t m_FrameIndex = 0;
+    size_t m_PeakBytes = 0;
+};
+
+// STL adapter; kontejner smi zit nejdele do konce nasledujiciho snimku
+template<typename T>
+class FrameStlAllocator {
+public:
+    using value_type = T;
+
+    FrameStlAllocator() : m_Frame(FrameAllocator::get().getFrameIndex()) {}
+    template<typename U>
+    FrameStlAllocator(const FrameStlAllocator<U>& other) : m_Frame(other.getFrame()) {}
+
+    T* allocate(size_t n) {
+        FrameAllocator& frame = FrameAllocator::get();
+        // Kontejner vytvoreny v drivejsim snimku, ktery dal roste = unik ze snimku
+        assert(frame.getFrameIndex() - m_Frame <= 1 && "frame memory used after its frame");
+        return static_cast<T*>(frame.allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, size_t n) {
+        FrameAllocator::get().deallocate(ptr, n * sizeof(T));
+    }
+
+    uint64_t getFrame() const { return m_Frame; }
+
+    template<typename U>
+    bool operator==(const FrameStlAllocator<U>&) const { return true; }
+    template<typename U>
+    bool operator!=(const FrameStlAllocator<U>&) const { return false; }
+
+private:
+    uint64_t m_Frame;
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameStlAllocator<T>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameStlAllocator<char>>;
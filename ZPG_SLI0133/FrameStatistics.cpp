@@ -0,0 +1,117 @@
+#include "FrameStatistics.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+void FrameStatistics::reserve(size_t frames) {
+    m_FrameTimes.reserve(frames);
+    for (std::vector<double>& phase : m_PhaseTimes) {
+        phase.reserve(frames);
+    }
+    m_GpuTimes.reserve(frames);
+}
+
+void FrameStatistics::addFrame(double frameTime, const double (&phaseTimes)[PHASE_COUNT]) {
+    m_FrameTimes.push_back(frameTime);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        m_PhaseTimes[phase].push_back(phaseTimes[phase]);
+    }
+}
+
+void FrameStatistics::addGpuTime(double gpuTime) {
+    m_GpuTimes.push_back(gpuTime);
+}
+
+void FrameStatistics::clear() {
+    m_FrameTimes.clear();
+    for (std::vector<double>& phase : m_PhaseTimes) {
+        phase.clear();
+    }
+    m_GpuTimes.clear();
+}
+
+const char* FrameStatistics::getPhaseName(FramePhase phase) {
+    switch (phase) {
+    case PHASE_INPUT: return "input";
+    case PHASE_UPDATE: return "update";
+    case PHASE_RENDER: return "render";
+    case PHASE_PRESENT: return "present";
+    default: return "?";
+    }
+}
+
+FrameStatistics::Summary FrameStatistics::summarize(std::vector<double> samples) {
+    Summary summary;
+    if (samples.empty()) return summary;
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double p) {
+        size_t rank = (size_t)std::ceil(p / 100.0 * (double)samples.size());
+        return samples[rank > 0 ? rank - 1 : 0];
+    };
+
+    double total = 0.0;
+    for (double sample : samples) total += sample;
+
+    summary.min = samples.front();
+    summary.max = samples.back();
+    summary.avg = total / (double)samples.size();
+    summary.p50 = percentile(50.0);
+    summary.p95 = percentile(95.0);
+    summary.p99 = percentile(99.0);
+    return summary;
+}
+
+void FrameStatistics::print(std::ostream& out) const {
+    if (m_FrameTimes.empty()) return;
+
+    auto row = [&out](const char* name, const Summary& s) {
+        out << std::left << std::setw(9) << name << std::right << std::fixed << std::setprecision(3)
+            << std::setw(9) << s.min * 1000.0 << std::setw(9) << s.avg * 1000.0
+            << std::setw(9) << s.p50 * 1000.0 << std::setw(9) << s.p95 * 1000.0
+            << std::setw(9) << s.p99 * 1000.0 << std::setw(9) << s.max * 1000.0 << "\n";
+    };
+
+    const Summary frame = getFrameSummary();
+    out << "Frames: " << m_FrameTimes.size() << " (" << std::fixed << std::setprecision(1)
+        << (frame.avg > 0.0 ? 1.0 / frame.avg : 0.0) << " FPS avg)\n";
+    out << std::left << std::setw(9) << "[ms]" << std::right
+        << std::setw(9) << "min" << std::setw(9) << "avg" << std::setw(9) << "p50"
+        << std::setw(9) << "p95" << std::setw(9) << "p99" << std::setw(9) << "max" << "\n";
+    row("frame", frame);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        row(getPhaseName((FramePhase)phase), getPhaseSummary((FramePhase)phase));
+    }
+    if (!m_GpuTimes.empty()) {
+        row("gpu", getGpuSummary());
+    }
+    out << std::defaultfloat << std::flush;
+}
+
+bool FrameStatistics::writeCsv(const std::string& path) const {
+    std::ofstream csv(path);
+    if (!csv) return false;
+
+    csv << "frame,ms";
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        csv << "," << getPhaseName((FramePhase)phase) << "_ms";
+    }
+    const bool hasGpu = !m_GpuTimes.empty();
+    if (hasGpu) csv << ",gpu_ms";
+    csv << "\n";
+
+    for (size_t i = 0; i < m_FrameTimes.size(); ++i) {
+        csv << i << "," << m_FrameTimes[i] * 1000.0;
+        for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+            csv << "," << m_PhaseTimes[phase][i] * 1000.0;
+        }
+        // GPU vysledky se zpozdi, posledni snimky zustanou bez hodnoty
+        if (hasGpu) {
+            csv << ",";
+            if (i < m_GpuTimes.size()) csv << m_GpuTimes[i] * 1000.0;
+        }
+        csv << "\n";
+    }
+    return true;
+}
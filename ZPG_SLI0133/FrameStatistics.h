@@ -0,0 +1,51 @@
+#pragma once
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum FramePhase {
+    PHASE_INPUT,    // polling a prehravani vstupu
+    PHASE_UPDATE,   // kroky simulace
+    PHASE_RENDER,   // CPU cast kresleni (scene->render)
+    PHASE_PRESENT,  // swap + udalosti, headless glFinish
+    PHASE_COUNT
+};
+
+// Casy snimku a jejich fazi; souhrn min/avg/percentily pro porovnani behu
+class FrameStatistics {
+public:
+    struct Summary {
+        double min = 0.0;
+        double avg = 0.0;
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    void reserve(size_t frames);
+    // Casy v sekundach
+    void addFrame(double frameTime, const double (&phaseTimes)[PHASE_COUNT]);
+    // Cas GPU z GL_TIME_ELAPSED dotazu; prichazi o par snimku pozdeji nez CPU casy
+    void addGpuTime(double gpuTime);
+    void clear();
+
+    size_t getFrameCount() const { return m_FrameTimes.size(); }
+    Summary getFrameSummary() const { return summarize(m_FrameTimes); }
+    Summary getPhaseSummary(FramePhase phase) const { return summarize(m_PhaseTimes[phase]); }
+    size_t getGpuSampleCount() const { return m_GpuTimes.size(); }
+    Summary getGpuSummary() const { return summarize(m_GpuTimes); }
+
+    static const char* getPhaseName(FramePhase phase);
+    // Percentily metodou nejblizsiho poradi
+    static Summary summarize(std::vector<double> samples);
+
+    // Tabulka v milisekundach
+    void print(std::ostream& out) const;
+    bool writeCsv(const std::string& path) const;
+
+private:
+    std::vector<double> m_FrameTimes;
+    std::vector<double> m_PhaseTimes[PHASE_COUNT];
+    std::vector<double> m_GpuTimes;
+};
@@ -0,0 +1,261 @@
+#include "GLRenderDevice.h"
+#include <vector>
+#include <glm/gtc/type_ptr.hpp>
+
+GLuint GLRenderDevice::genBuffer() {
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    return buffer;
+}
+
+void GLRenderDevice::deleteBuffer(GLuint buffer) {
+    glDeleteBuffers(1, &buffer);
+}
+
+void GLRenderDevice::bindBuffer(GLenum target, GLuint buffer) {
+    glBindBuffer(target, buffer);
+}
+
+void GLRenderDevice::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    glBindBufferBase(target, index, buffer);
+}
+
+void GLRenderDevice::bufferData(GLenum target, size_t size, const void* data, GLenum usage) {
+    glBufferData(target, (GLsizeiptr)size, data, usage);
+}
+
+void GLRenderDevice::bufferSubData(GLenum target, size_t offset, size_t size, const void* data) {
+    glBufferSubData(target, (GLintptr)offset, (GLsizeiptr)size, data);
+}
+
+GLuint GLRenderDevice::genVertexArray() {
+    GLuint vao = 0;
+    glGenVertexArrays(1, &vao);
+    return vao;
+}
+
+void GLRenderDevice::deleteVertexArray(GLuint vao) {
+    glDeleteVertexArrays(1, &vao);
+}
+
+void GLRenderDevice::bindVertexArray(GLuint vao) {
+    glBindVertexArray(vao);
+}
+
+void GLRenderDevice::enableVertexAttribArray(GLuint index) {
+    glEnableVertexAttribArray(index);
+}
+
+void GLRenderDevice::vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, size_t offset) {
+    glVertexAttribPointer(index, size, type, normalized, stride, (const GLvoid*)offset);
+}
+
+GLuint GLRenderDevice::genTexture() {
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    return texture;
+}
+
+void GLRenderDevice::deleteTexture(GLuint texture) {
+    glDeleteTextures(1, &texture);
+}
+
+void GLRenderDevice::activeTexture(GLenum unit) {
+    glActiveTexture(unit);
+}
+
+void GLRenderDevice::bindTexture(GLenum target, GLuint texture) {
+    glBindTexture(target, texture);
+}
+
+void GLRenderDevice::texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height,
+    GLenum format, GLenum type, const void* data) {
+    glTexImage2D(target, level, internalFormat, width, height, 0, format, type, data);
+}
+
+void GLRenderDevice::texParameteri(GLenum target, GLenum name, GLint value) {
+    glTexParameteri(target, name, value);
+}
+
+void GLRenderDevice::generateMipmap(GLenum target) {
+    glGenerateMipmap(target);
+}
+
+GLuint GLRenderDevice::createShader(GLenum type) {
+    return glCreateShader(type);
+}
+
+void GLRenderDevice::deleteShader(GLuint shader) {
+    glDeleteShader(shader);
+}
+
+void GLRenderDevice::shaderSource(GLuint shader, const char* source) {
+    glShaderSource(shader, 1, &source, NULL);
+}
+
+void GLRenderDevice::compileShader(GLuint shader) {
+    glCompileShader(shader);
+}
+
+GLint GLRenderDevice::getShaderi(GLuint shader, GLenum name) {
+    GLint value = 0;
+    glGetShaderiv(shader, name, &value);
+    return value;
+}
+
+std::string GLRenderDevice::getShaderInfoLog(GLuint shader) {
+    GLint length = 0;
+    glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+    if (length <= 0) return std::string();
+    std::vector<char> log((size_t)length);
+    glGetShaderInfoLog(shader, length, NULL, log.data());
+    return std::string(log.data());
+}
+
+GLuint GLRenderDevice::createProgram() {
+    return glCreateProgram();
+}
+
+void GLRenderDevice::deleteProgram(GLuint program) {
+    glDeleteProgram(program);
+}
+
+void GLRenderDevice::attachShader(GLuint program, GLuint shader) {
+    glAttachShader(program, shader);
+}
+
+void GLRenderDevice::programParameteri(GLuint program, GLenum name, GLint value) {
+    glProgramParameteri(program, name, value);
+}
+
+void GLRenderDevice::linkProgram(GLuint program) {
+    glLinkProgram(program);
+}
+
+GLint GLRenderDevice::getProgrami(GLuint program, GLenum name) {
+    GLint value = 0;
+    glGetProgramiv(program, name, &value);
+    return value;
+}
+
+std::string GLRenderDevice::getProgramInfoLog(GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+    if (length <= 0) return std::string();
+    std::vector<char> log((size_t)length);
+    glGetProgramInfoLog(program, length, NULL, log.data());
+    return std::string(log.data());
+}
+
+GLint GLRenderDevice::getUniformLocation(GLuint program, const char* name) {
+    return glGetUniformLocation(program, name);
+}
+
+GLuint GLRenderDevice::getUniformBlockIndex(GLuint program, const char* name) {
+    return glGetUniformBlockIndex(program, name);
+}
+
+void GLRenderDevice::uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) {
+    glUniformBlockBinding(program, blockIndex, binding);
+}
+
+void GLRenderDevice::useProgram(GLuint program) {
+    glUseProgram(program);
+}
+
+void GLRenderDevice::uniform(GLint location, int value) {
+    glUniform1i(location, value);
+}
+
+void GLRenderDevice::uniform(GLint location, float value) {
+    glUniform1f(location, value);
+}
+
+void GLRenderDevice::uniform(GLint location, const glm::vec3& value) {
+    glUniform3fv(location, 1, glm::value_ptr(value));
+}
+
+void GLRenderDevice::uniform(GLint location, const glm::vec4& value) {
+    glUniform4fv(location, 1, glm::value_ptr(value));
+}
+
+void GLRenderDevice::uniform(GLint location, const glm::ivec4& value) {
+    glUniform4iv(location, 1, glm::value_ptr(value));
+}
+
+void GLRenderDevice::uniform(GLint location, const glm::mat3& value) {
+    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void GLRenderDevice::uniform(GLint location, const glm::mat4& value) {
+    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void GLRenderDevice::enable(GLenum capability) {
+    glEnable(capability);
+}
+
+void GLRenderDevice::disable(GLenum capability) {
+    glDisable(capability);
+}
+
+void GLRenderDevice::depthFunc(GLenum func) {
+    glDepthFunc(func);
+}
+
+void GLRenderDevice::depthMask(GLboolean enabled) {
+    glDepthMask(enabled);
+}
+
+void GLRenderDevice::colorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    glColorMask(r, g, b, a);
+}
+
+void GLRenderDevice::stencilFunc(GLenum func, GLint ref, GLuint mask) {
+    glStencilFunc(func, ref, mask);
+}
+
+void GLRenderDevice::stencilOp(GLenum stencilFail, GLenum depthFail, GLenum pass) {
+    glStencilOp(stencilFail, depthFail, pass);
+}
+
+void GLRenderDevice::stencilMask(GLuint mask) {
+    glStencilMask(mask);
+}
+
+void GLRenderDevice::getViewport(GLint viewport[4]) {
+    glGetIntegerv(GL_VIEWPORT, viewport);
+}
+
+void GLRenderDevice::drawArrays(GLenum mode, GLint first, GLsizei count) {
+    glDrawArrays(mode, first, count);
+}
+
+void GLRenderDevice::genQueries(GLsizei count, GLuint* queries) {
+    glGenQueries(count, queries);
+}
+
+void GLRenderDevice::deleteQueries(GLsizei count, const GLuint* queries) {
+    glDeleteQueries(count, queries);
+}
+
+void GLRenderDevice::beginQuery(GLenum target, GLuint query) {
+    glBeginQuery(target, query);
+}
+
+void GLRenderDevice::endQuery(GLenum target) {
+    glEndQuery(target);
+}
+
+bool GLRenderDevice::isQueryResultAvailable(GLuint query) {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    return available != GL_FALSE;
+}
+
+GLuint64 GLRenderDevice::getQueryResult(GLuint query) {
+    // 64 bitu: cas v nanosekundach pretece 32 bitu uz po 4 s
+    GLuint64 result = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &result);
+    return result;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "RenderDevice.h"
+
+// Primo GL; predpoklada aktualni kontext a inicializovany GLEW
+class GLRenderDevice : public RenderDevice {
+public:
+    bool isNull() const override { return false; }
+
+    GLuint genBuffer() override;
+    void deleteBuffer(GLuint buffer) override;
+    void bindBuffer(GLenum target, GLuint buffer) override;
+    void bindBufferBase(GLenum target, GLuint index, GLuint buffer) override;
+    void bufferData(GLenum target, size_t size, const void* data, GLenum usage) override;
+    void bufferSubData(GLenum target, size_t offset, size_t size, const void* data) override;
+
+    GLuint genVertexArray() override;
+    void deleteVertexArray(GLuint vao) override;
+    void bindVertexArray(GLuint vao) override;
+    void enableVertexAttribArray(GLuint index) override;
+    void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, size_t offset) override;
+
+    GLuint genTexture() override;
+    void deleteTexture(GLuint texture) override;
+    void activeTexture(GLenum unit) override;
+    void bindTexture(GLenum target, GLuint texture) override;
+    void texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height,
+        GLenum format, GLenum type, const void* data) override;
+    void texParameteri(GLenum target, GLenum name, GLint value) override;
+    void generateMipmap(GLenum target) override;
+
+    GLuint createShader(GLenum type) override;
+    void deleteShader(GLuint shader) override;
+    void shaderSource(GLuint shader, const char* source) override;
+    void compileShader(GLuint shader) override;
+    GLint getShaderi(GLuint shader, GLenum name) override;
+    std::string getShaderInfoLog(GLuint shader) override;
+
+    GLuint createProgram() override;
+    void deleteProgram(GLuint program) override;
+    void attachShader(GLuint program, GLuint shader) override;
+    void programParameteri(GLuint program, GLenum name, GLint value) override;
+    void linkProgram(GLuint program) override;
+    GLint getProgrami(GLuint program, GLenum name) override;
+    std::string getProgramInfoLog(GLuint program) override;
+    GLint getUniformLocation(GLuint program, const char* name) override;
+    GLuint getUniformBlockIndex(GLuint program, const char* name) override;
+    void uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) override;
+    void useProgram(GLuint program) override;
+
+    void uniform(GLint location, int value) override;
+    void uniform(GLint location, float value) override;
+    void uniform(GLint location, const glm::vec3& value) override;
+    void uniform(GLint location, const glm::vec4& value) override;
+    void uniform(GLint location, const glm::ivec4& value) override;
+    void uniform(GLint location, const glm::mat3& value) override;
+    void uniform(GLint location, const glm::mat4& value) override;
+
+    void enable(GLenum capability) override;
+    void disable(GLenum capability) override;
+    void depthFunc(GLenum func) override;
+    void depthMask(GLboolean enabled) override;
+    void colorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) override;
+    void stencilFunc(GLenum func, GLint ref, GLuint mask) override;
+    void stencilOp(GLenum stencilFail, GLenum depthFail, GLenum pass) override;
+    void stencilMask(GLuint mask) override;
+    void getViewport(GLint viewport[4]) override;
+
+    void drawArrays(GLenum mode, GLint first, GLsizei count) override;
+
+    void genQueries(GLsizei count, GLuint* queries) override;
+    void deleteQueries(GLsizei count, const GLuint* queries) override;
+    void beginQuery(GLenum target, GLuint query) override;
+    void endQuery(GLenum target) override;
+    bool isQueryResultAvailable(GLuint query) override;
+    GLuint64 getQueryResult(GLuint query) override;
+};
@@ -0,0 +1,159 @@
+#include "GpuProfiler.h"
+#include "FrameStatistics.h"
+#include <cstring>
+#include <iomanip>
+
+GpuProfiler& GpuProfiler::get() {
+    static GpuProfiler instance;
+    return instance;
+}
+
+void GpuProfiler::beginFrame() {
+    collect();
+
+    // Vsechny sady dotazu jeste cekaji na GPU: tento snimek se nemeri, radsi nez cekat
+    Frame& frame = m_Frames[m_Current];
+    if (frame.pending) {
+        m_InFrame = false;
+        return;
+    }
+
+    frame.zones.clear();
+    frame.usedQueries = 0;
+    frame.lastIssued = -1;
+
+    // GL_TIMESTAMP bez cekani na dokonceni prace; posun mezi hodinami GPU a profileru
+    GLint64 gpuNow = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+    frame.cpuOffset = Profiler::now() - (int64_t)gpuNow;
+    m_InFrame = true;
+}
+
+void GpuProfiler::endFrame() {
+    if (!m_InFrame) return;
+    m_InFrame = false;
+
+    Frame& frame = m_Frames[m_Current];
+    if (frame.zones.empty()) return;
+    frame.pending = true;
+    m_Current = (m_Current + 1) % FRAME_LATENCY;
+}
+
+int GpuProfiler::beginZone(const char* name) {
+    if (!m_InFrame) return -1;
+
+    Frame& frame = m_Frames[m_Current];
+    if (frame.usedQueries + 2 > MAX_ZONES_PER_FRAME * 2) return -1;
+
+    // Dotazy se vytvari postupne, per-draw zony jich potrebuji mnohem vic nez passy
+    if (frame.usedQueries + 2 > (int)frame.queries.size()) {
+        const int GROW = 128;
+        size_t oldSize = frame.queries.size();
+        frame.queries.resize(oldSize + GROW);
+        glGenQueries(GROW, &frame.queries[oldSize]);
+    }
+
+    Zone zone;
+    zone.name = name;
+    zone.queryIndex = frame.usedQueries;
+    zone.ended = false;
+    frame.usedQueries += 2;
+    glQueryCounter(frame.queries[zone.queryIndex], GL_TIMESTAMP);
+    frame.lastIssued = zone.queryIndex;
+
+    frame.zones.push_back(zone);
+    return (int)frame.zones.size() - 1;
+}
+
+void GpuProfiler::endZone(int zone) {
+    if (!m_InFrame) return;
+
+    Frame& frame = m_Frames[m_Current];
+    if (zone < 0 || zone >= (int)frame.zones.size()) return;
+    Zone& ended = frame.zones[zone];
+    glQueryCounter(frame.queries[ended.queryIndex + 1], GL_TIMESTAMP);
+    ended.ended = true;
+    frame.lastIssued = ended.queryIndex + 1;
+}
+
+void GpuProfiler::collect() {
+    // Od nejstarsiho; m_Current je sada, ktera se bude plnit jako dalsi
+    for (int n = 0; n < FRAME_LATENCY; ++n) {
+        Frame& frame = m_Frames[(m_Current + n) % FRAME_LATENCY];
+        if (!frame.pending) continue;
+
+        // Naposledy zadany dotaz je hotovy az po vsech predchozich
+        GLuint available = GL_FALSE;
+        glGetQueryObjectuiv(frame.queries[frame.lastIssued], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) break;
+
+        readFrame(frame);
+        frame.pending = false;
+    }
+}
+
+void GpuProfiler::readFrame(Frame& frame) {
+    if (!m_Track) {
+        m_Track = &Profiler::get().createTrack("GPU", "gpu");
+    }
+
+    std::vector<double> totals(m_Samples.size(), -1.0);
+    for (const Zone& zone : frame.zones) {
+        if (!zone.ended) continue;
+        GLuint64 start = 0, end = 0;
+        glGetQueryObjectui64v(frame.queries[zone.queryIndex], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(frame.queries[zone.queryIndex + 1], GL_QUERY_RESULT, &end);
+        if (end < start) end = start;
+
+        Profiler::get().record(*m_Track, zone.name, (int64_t)start + frame.cpuOffset, (int64_t)end + frame.cpuOffset);
+
+        // Stejny nazev (per-draw zony) se za snimek secte
+        size_t index = 0;
+        while (index < m_Samples.size() && m_Samples[index].name != zone.name
+            && std::strcmp(m_Samples[index].name, zone.name) != 0) {
+            ++index;
+        }
+        if (index == m_Samples.size()) {
+            ZoneSamples samples;
+            samples.name = zone.name;
+            m_Samples.push_back(samples);
+            totals.push_back(-1.0);
+        }
+        totals[index] = (totals[index] < 0.0 ? 0.0 : totals[index]) + (double)(end - start) * 1e-9;
+    }
+
+    for (size_t i = 0; i < totals.size(); ++i) {
+        if (totals[i] >= 0.0) m_Samples[i].times.push_back(totals[i]);
+    }
+}
+
+void GpuProfiler::resetStatistics() {
+    m_Samples.clear();
+}
+
+void GpuProfiler::print(std::ostream& out) const {
+    if (m_Samples.empty()) return;
+
+    out << std::left << std::setw(20) << "GPU zones [ms]" << std::right
+        << std::setw(9) << "min" << std::setw(9) << "avg" << std::setw(9) << "p50"
+        << std::setw(9) << "p95" << std::setw(9) << "p99" << std::setw(9) << "max" << "\n";
+    for (const ZoneSamples& samples : m_Samples) {
+        const FrameStatistics::Summary s = FrameStatistics::summarize(samples.times);
+        out << std::left << std::setw(20) << samples.name << std::right << std::fixed << std::setprecision(3)
+            << std::setw(9) << s.min * 1000.0 << std::setw(9) << s.avg * 1000.0
+            << std::setw(9) << s.p50 * 1000.0 << std::setw(9) << s.p95 * 1000.0
+            << std::setw(9) << s.p99 * 1000.0 << std::setw(9) << s.max * 1000.0 << "\n";
+    }
+    out << std::defaultfloat << std::flush;
+}
+
+void GpuProfiler::clear() {
+    for (Frame& frame : m_Frames) {
+        if (!frame.queries.empty()) {
+            glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+        }
+        frame = Frame();
+    }
+    m_Current = 0;
+    m_InFrame = false;
+}
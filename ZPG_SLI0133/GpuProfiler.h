@@ -0,0 +1,98 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "Profiler.h"
+
+// GPU zony z GL_TIMESTAMP dotazu (glQueryCounter se muze vnorovat a nekoliduje
+// s GL_TIME_ELAPSED ani GL_SAMPLES_PASSED). Kazdy snimek ma vlastni sadu dotazu,
+// vysledky se ctou az o FRAME_LATENCY - 1 snimku pozdeji, bez cekani na GPU.
+// Zony jdou do Chrome trace jako stopa "GPU" a do souhrnu po zonach.
+class GpuProfiler {
+public:
+    static const int FRAME_LATENCY = 4;
+    static const int MAX_ZONES_PER_FRAME = 2048;
+
+    static GpuProfiler& get();
+
+    // CPU i GPU zony kolem jednotlivych draw callu (ZPG_*_DRAW_SCOPE, --gpu-draw-zones);
+    // vychozi vypnuto, jejich rezie by zkreslila mereni
+    void setPerDrawEnabled(bool enabled) { m_PerDraw = enabled; }
+    bool isPerDrawEnabled() const { return m_PerDraw; }
+
+    // Render::run, na zacatku a konci snimku
+    void beginFrame();
+    void endFrame();
+
+    // -1 = zona se nemeri (mimo snimek nebo plna sada dotazu)
+    int beginZone(const char* name);
+    void endZone(int zone);
+
+    // Souhrn casu zon po snimcich (stejne percentily jako FrameStatistics)
+    void resetStatistics();
+    void print(std::ostream& out) const;
+
+    // Smaze dotazy; volat pred znicenim GL kontextu
+    void clear();
+
+private:
+    struct Zone {
+        const char* name;
+        int queryIndex; // start = queryIndex, konec = queryIndex + 1
+        bool ended;     // bez endZone nebyl koncovy dotaz zadan, zona se necte
+    };
+
+    struct Frame {
+        std::vector<GLuint> queries;
+        std::vector<Zone> zones;
+        int usedQueries = 0;
+        // Naposledy zadany dotaz; u vnorenych zon to neni posledni index (konec vnejsi zony)
+        int lastIssued = -1;
+        bool pending = false;
+        int64_t cpuOffset = 0; // Profiler::now() - GL_TIMESTAMP na zacatku snimku
+    };
+
+    struct ZoneSamples {
+        const char* name;
+        std::vector<double> times; // soucet zon se stejnym nazvem za snimek [s]
+    };
+
+    GpuProfiler() = default;
+    void collect();
+    void readFrame(Frame& frame);
+
+    Frame m_Frames[FRAME_LATENCY];
+    int m_Current = 0;
+    bool m_InFrame = false;
+    bool m_PerDraw = false;
+    ProfileTrack* m_Track = nullptr;
+    std::vector<ZoneSamples> m_Samples;
+};
+
+class GpuProfileScope {
+public:
+    explicit GpuProfileScope(const char* name, bool enabled = true)
+        : m_Zone(enabled ? GpuProfiler::get().beginZone(name) : -1) {
+    }
+    ~GpuProfileScope() {
+        if (m_Zone >= 0) GpuProfiler::get().endZone(m_Zone);
+    }
+
+    GpuProfileScope(const GpuProfileScope&) = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+
+private:
+    int m_Zone;
+};
+
+#if ZPG_PROFILE
+#define ZPG_GPU_SCOPE(name) GpuProfileScope ZPG_PROFILE_CONCAT(zpgGpuScope, __LINE__)(name)
+#define ZPG_GPU_DRAW_SCOPE(name) GpuProfileScope ZPG_PROFILE_CONCAT(zpgGpuScope, __LINE__)(name, GpuProfiler::get().isPerDrawEnabled())
+#define ZPG_PROFILE_DRAW_SCOPE(name) ProfileScope ZPG_PROFILE_CONCAT(zpgProfileScope, __LINE__)(name, GpuProfiler::get().isPerDrawEnabled())
+#else
+#define ZPG_GPU_SCOPE(name) ((void)0)
+#define ZPG_GPU_DRAW_SCOPE(name) ((void)0)
+#define ZPG_PROFILE_DRAW_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,110 @@
+#include "HeadlessContext.h"
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef ZPG_HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+bool HeadlessContext::isSupported() {
+#ifdef ZPG_HEADLESS_EGL
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef ZPG_HEADLESS_EGL
+
+static EGLDisplay openDisplay() {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    // Surfaceless platforma nepotrebuje X ani Wayland
+#ifdef EGL_PLATFORM_SURFACELESS_MESA
+    auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if (getPlatformDisplay) {
+        display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    }
+#endif
+    if (display == EGL_NO_DISPLAY) {
+        display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+    return display;
+}
+
+HeadlessContext::HeadlessContext() {
+    EGLDisplay display = openDisplay();
+    EGLint major = 0, minor = 0;
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor)) {
+        std::cerr << "EGL error: 0x" << std::hex << eglGetError() << std::dec << std::endl;
+        throw std::runtime_error("Failed to initialize EGL display");
+    }
+    m_Display = display;
+
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    const bool surfaceless = extensions && std::strstr(extensions, "EGL_KHR_surfaceless_context");
+
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+        EGL_DEPTH_SIZE, 24, EGL_STENCIL_SIZE, 8,
+        EGL_NONE
+    };
+    EGLConfig config;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0) {
+        eglTerminate(display);
+        throw std::runtime_error("No suitable EGL config");
+    }
+
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint contextAttribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+    if (context == EGL_NO_CONTEXT) {
+        eglTerminate(display);
+        throw std::runtime_error("Failed to create EGL OpenGL 3.3 core context");
+    }
+    m_Context = context;
+
+    // Vychozi framebuffer se nepouziva, pbuffer je jen kvuli eglMakeCurrent
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!surfaceless) {
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surface = eglCreatePbufferSurface(display, config, pbufferAttribs);
+        m_Surface = surface;
+    }
+
+    if (!eglMakeCurrent(display, surface, surface, context)) {
+        std::cerr << "EGL error: 0x" << std::hex << eglGetError() << std::dec << std::endl;
+        throw std::runtime_error("Failed to make EGL context current");
+    }
+
+    std::cout << "Headless EGL " << major << "." << minor
+        << (surfaceless ? " (surfaceless)" : " (pbuffer)") << std::endl;
+}
+
+HeadlessContext::~HeadlessContext() {
+    if (!m_Display) return;
+    eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (m_Surface) eglDestroySurface(m_Display, m_Surface);
+    if (m_Context) eglDestroyContext(m_Display, m_Context);
+    eglTerminate(m_Display);
+}
+
+#else
+
+HeadlessContext::HeadlessContext() {
+    throw std::runtime_error("Headless mode requires a build with ZPG_HEADLESS_EGL");
+}
+
+HeadlessContext::~HeadlessContext() {
+}
+
+#endif
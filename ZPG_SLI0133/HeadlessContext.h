@@ -0,0 +1,22 @@
+#pragma once
+
+// OpenGL 3.3 core kontext bez okna pres EGL (surfaceless, jinak 1x1 pbuffer),
+// napr. Mesa llvmpipe na build serverech. Kresli se do OffscreenTarget.
+// Jen v buildu s ZPG_HEADLESS_EGL a libEGL (linuxovy CMakeLists.txt v koreni repozitare),
+// jinak konstruktor vyhodi vyjimku.
+class HeadlessContext {
+public:
+    HeadlessContext();
+    ~HeadlessContext();
+
+    HeadlessContext(const HeadlessContext&) = delete;
+    HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+    static bool isSupported();
+
+private:
+    // EGLDisplay / EGLContext / EGLSurface, at hlavicka nezavisi na EGL
+    void* m_Display = nullptr;
+    void* m_Context = nullptr;
+    void* m_Surface = nullptr;
+};
@@ -1,6 +1,9 @@
 #include "InputController.h"
 #include "Scene.h"  
 #include "Camera.h" 
+#include "InputRecorder.h"
+#include "GpuProfiler.h"
+#include "DynamicResolution.h"
 #include <glm/gtc/constants.hpp>
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
@@ -10,8 +13,21 @@ InputController::InputController(Application& app, GLFWwindow* window, float ini
 }
 
 
+bool InputController::isKeyDown(int key) {
+    if (m_Recorder && m_Recorder->isReplaying()) {
+        return m_Recorder->isKeyDown(key);
+    }
+    if (!m_Window) return false;
+
+    bool down = glfwGetKey(m_Window, key) == GLFW_PRESS;
+    if (down && m_Recorder) {
+        m_Recorder->recordKeyDown(key);
+    }
+    return down;
+}
+
 void InputController::processPollingInput(float deltaTime) {
-    if (glfwGetKey(m_Window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+    if (isKeyDown(GLFW_KEY_ESCAPE) && m_Window)
         glfwSetWindowShouldClose(m_Window, true);
 
     Scene* scene = m_App.getActiveScene();
@@ -22,42 +38,127 @@ void InputController::processPollingInput(float deltaTime) {
     // In scene 4 is static position
     if (currentSceneIdx != 4) {
         const float cameraSpeed = 5.0f * deltaTime;
-        if (glfwGetKey(m_Window, GLFW_KEY_W) == GLFW_PRESS)
+        if (isKeyDown(GLFW_KEY_W))
             processCameraKeyboard(CameraMovement::FORWARD, cameraSpeed);
-        if (glfwGetKey(m_Window, GLFW_KEY_S) == GLFW_PRESS)
+        if (isKeyDown(GLFW_KEY_S))
             processCameraKeyboard(CameraMovement::BACKWARD, cameraSpeed);
-        if (glfwGetKey(m_Window, GLFW_KEY_A) == GLFW_PRESS)
+        if (isKeyDown(GLFW_KEY_A))
             processCameraKeyboard(CameraMovement::LEFT, cameraSpeed);
-        if (glfwGetKey(m_Window, GLFW_KEY_D) == GLFW_PRESS)
+        if (isKeyDown(GLFW_KEY_D))
             processCameraKeyboard(CameraMovement::RIGHT, cameraSpeed);
     }
 
-    if (glfwGetKey(m_Window, GLFW_KEY_1) == GLFW_PRESS) m_App.loadScene(1);
-    if (glfwGetKey(m_Window, GLFW_KEY_2) == GLFW_PRESS) m_App.loadScene(2);
-    if (glfwGetKey(m_Window, GLFW_KEY_3) == GLFW_PRESS) m_App.loadScene(3);
-    if (glfwGetKey(m_Window, GLFW_KEY_4) == GLFW_PRESS) m_App.loadScene(4);
-    if (glfwGetKey(m_Window, GLFW_KEY_0) == GLFW_PRESS) m_App.loadScene(0);
+    if (isKeyDown(GLFW_KEY_1)) m_App.loadScene(1);
+    if (isKeyDown(GLFW_KEY_2)) m_App.loadScene(2);
+    if (isKeyDown(GLFW_KEY_3)) m_App.loadScene(3);
+    if (isKeyDown(GLFW_KEY_4)) m_App.loadScene(4);
+    if (isKeyDown(GLFW_KEY_0)) m_App.loadScene(0);
+}
+
+void InputController::dispatchReplayEvents() {
+    if (!m_Recorder || !m_Recorder->isReplaying()) return;
+
+    for (const InputRecorder::Event& event : m_Recorder->getFrameEvents()) {
+        switch (event.type) {
+        case InputRecorder::Event::KEY: handleKey(event.code, event.scancode, event.action, event.mods); break;
+        case InputRecorder::Event::MOUSE_BUTTON: handleMouseButton(event.code, event.action, event.mods); break;
+        case InputRecorder::Event::CURSOR: handleCursorPos(event.x, event.y); break;
+        case InputRecorder::Event::SCROLL: handleScroll(event.x, event.y); break;
+        }
+    }
 }
 
 void InputController::onKey(int key, int scancode, int action, int mods) {
+    if (m_Recorder) {
+        if (m_Recorder->isReplaying()) return;
+        InputRecorder::Event event;
+        event.type = InputRecorder::Event::KEY;
+        event.code = key;
+        event.scancode = scancode;
+        event.action = action;
+        event.mods = mods;
+        m_Recorder->recordEvent(event);
+    }
+    handleKey(key, scancode, action, mods);
+}
+
+void InputController::onMouseButton(int button, int action, int mods) {
+    if (m_Recorder) {
+        if (m_Recorder->isReplaying()) return;
+        InputRecorder::Event event;
+        event.type = InputRecorder::Event::MOUSE_BUTTON;
+        event.code = button;
+        event.action = action;
+        event.mods = mods;
+        m_Recorder->recordEvent(event);
+    }
+    handleMouseButton(button, action, mods);
+}
+
+void InputController::onCursorPos(double xpos, double ypos) {
+    if (m_Recorder) {
+        if (m_Recorder->isReplaying()) return;
+        InputRecorder::Event event;
+        event.type = InputRecorder::Event::CURSOR;
+        event.x = xpos;
+        event.y = ypos;
+        m_Recorder->recordEvent(event);
+    }
+    handleCursorPos(xpos, ypos);
+}
+
+void InputController::onScroll(double xoffset, double yoffset) {
+    if (m_Recorder) {
+        if (m_Recorder->isReplaying()) return;
+        InputRecorder::Event event;
+        event.type = InputRecorder::Event::SCROLL;
+        event.x = xoffset;
+        event.y = yoffset;
+        m_Recorder->recordEvent(event);
+    }
+    handleScroll(xoffset, yoffset);
+}
+
+void InputController::handleKey(int key, int scancode, int action, int mods) {
     if (key == GLFW_KEY_F && action == GLFW_PRESS) {
         Scene* scene = m_App.getActiveScene();
         if (scene) {
             scene->toggleFlashlight();
         }
     }
+    if (key == GLFW_KEY_Z && action == GLFW_PRESS) {
+        Scene* scene = m_App.getActiveScene();
+        if (scene) {
+            scene->toggleDepthPrepass();
+        }
+    }
+    if (key == GLFW_KEY_G && action == GLFW_PRESS) {
+        Scene* scene = m_App.getActiveScene();
+        if (scene) {
+            scene->toggleRenderPath();
+        }
+    }
+    if (key == GLFW_KEY_O && action == GLFW_PRESS) {
+        Scene* scene = m_App.getActiveScene();
+        if (scene) {
+            scene->printFragmentStats();
+        }
+    }
+    if (key == GLFW_KEY_F12 && action == GLFW_PRESS) {
+        m_App.writeTrace();
+    }
 }
 
-void InputController::onMouseButton(int button, int action, int mods) {
+void InputController::handleMouseButton(int button, int action, int mods) {
     if (button == GLFW_MOUSE_BUTTON_RIGHT) {
         if (action == GLFW_PRESS) {
             m_RightButtonPressed = true;
-            glfwSetInputMode(m_Window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+            if (m_Window) glfwSetInputMode(m_Window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
         }
         else if (action == GLFW_RELEASE) {
             m_RightButtonPressed = false;
             m_FirstMouse = true;
-            glfwSetInputMode(m_Window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+            if (m_Window) glfwSetInputMode(m_Window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
         }
     }
 
@@ -66,12 +167,35 @@ void InputController::onMouseButton(int button, int action, int mods) {
         if (!scene) return;
         Camera& camera = scene->getCamera();
 
-        double xpos, ypos;
-        glfwGetCursorPos(m_Window, &xpos, &ypos);
+        // Posledni pozice z callbacku, aby picking sel prehrat
+        double xpos = m_LastX, ypos = m_LastY;
         int width, height;
-        glfwGetWindowSize(m_Window, &width, &height);
+        if (m_Window) {
+            glfwGetWindowSize(m_Window, &width, &height);
+        }
+        else {
+            GLint viewport[4];
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            width = viewport[2];
+            height = viewport[3];
+        }
 
         if (width == 0 || height == 0) return;
+        // glReadPixels ceka na dokonceni snimku; zona ukaze, kolik to stoji na GPU
+        ZPG_GPU_SCOPE("Picking");
+
+        // S dynamickym rozlisenim je scena (stencil, hloubka) v mensim cili,
+        // pozice v okne se prepocte na jeho pixely
+        DynamicResolution* dynamicResolution = m_App.getDynamicResolution();
+        GLint readFBO = 0;
+        if (dynamicResolution) {
+            xpos = xpos * dynamicResolution->getRenderWidth() / width;
+            ypos = ypos * dynamicResolution->getRenderHeight() / height;
+            width = dynamicResolution->getRenderWidth();
+            height = dynamicResolution->getRenderHeight();
+            glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFBO);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, dynamicResolution->getFBO());
+        }
 
         GLint x = (GLint)xpos;
         GLint y = (GLint)ypos;
@@ -79,6 +203,11 @@ void InputController::onMouseButton(int button, int action, int mods) {
 
         GLuint index;
         glReadPixels(x, newy, 1, 1, GL_STENCIL_INDEX, GL_UNSIGNED_INT, &index);
+        GLfloat depth = 1.0f;
+        if (m_App.getCurrentSceneIndex() != 4) {
+            glReadPixels(x, newy, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &depth);
+        }
+        if (dynamicResolution) glBindFramebuffer(GL_READ_FRAMEBUFFER, (GLuint)readFBO);
 
         GLuint objectID = index & 0xFF;
 
@@ -89,9 +218,6 @@ void InputController::onMouseButton(int button, int action, int mods) {
             }
         }
         else {
-            GLfloat depth;
-            glReadPixels(x, newy, 1, 1, GL_DEPTH_COMPONENT, GL_FLOAT, &depth);
-
             if (depth < 1.0f) {
                 glm::vec3 screenPos = glm::vec3(x, newy, depth);
                 glm::mat4 view = camera.getViewMatrix();
@@ -104,7 +230,7 @@ void InputController::onMouseButton(int button, int action, int mods) {
     }
 }
 
-void InputController::onCursorPos(double xpos, double ypos) {
+void InputController::handleCursorPos(double xpos, double ypos) {
     if (m_FirstMouse) {
         m_LastX = (float)xpos;
         m_LastY = (float)ypos;
@@ -122,7 +248,7 @@ void InputController::onCursorPos(double xpos, double ypos) {
     }
 }
 
-void InputController::onScroll(double xoffset, double yoffset) {
+void InputController::handleScroll(double xoffset, double yoffset) {
     processCameraScroll((float)yoffset);
 }
 
@@ -143,7 +269,6 @@ void InputController::processCameraMouse(float xoffset, float yoffset, bool cons
 
     camera.setFi(fi);
     camera.setAlpha(alpha);
-    camera.updateMatrices();
 }
 
 void InputController::processCameraScroll(float yoffset) {
@@ -158,7 +283,6 @@ void InputController::processCameraScroll(float yoffset) {
     }
 
     camera.setFOV(fov);
-    camera.updateMatrices();
 }
 
 void InputController::processCameraKeyboard(CameraMovement direction, float velocity) {
@@ -187,5 +311,4 @@ void InputController::processCameraKeyboard(CameraMovement direction, float velo
     }
 
     camera.setPosition(position);
-    camera.updateMatrices();
 }
\ No newline at end of file
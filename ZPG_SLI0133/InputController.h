@@ -7,6 +7,7 @@
 #include <cmath>
 
 class Camera;
+class InputRecorder;
 
 enum class CameraMovement {
     FORWARD,
@@ -19,6 +20,7 @@ class InputController {
 private:
     Application& m_App;
     GLFWwindow* m_Window;
+    InputRecorder* m_Recorder = nullptr;
 
     bool m_RightButtonPressed = false;
     bool m_FirstMouse = true;
@@ -31,11 +33,26 @@ private:
     void processCameraMouse(float xoffset, float yoffset, bool constrainPitch);
     void processCameraScroll(float yoffset);
 
+    // Polling klavesy: zive z okna, pri prehravani ze zaznamu
+    bool isKeyDown(int key);
+
+    void handleKey(int key, int scancode, int action, int mods);
+    void handleMouseButton(int button, int action, int mods);
+    void handleCursorPos(double xpos, double ypos);
+    void handleScroll(double xoffset, double yoffset);
+
 public:
+    // window smi byt nullptr (headless), vstup pak prichazi jen z prehravani
     InputController(Application& app, GLFWwindow* window, float initialX, float initialY);
 
+    // Zaznam nebo prehravani vstupu (nullptr = jen zivy vstup)
+    void setRecorder(InputRecorder* recorder) { m_Recorder = recorder; }
+
     void processPollingInput(float deltaTime);
+    // Udalosti aktualniho snimku ze zaznamu, na miste glfwPollEvents
+    void dispatchReplayEvents();
 
+    // GLFW callbacky; pri prehravani se zivy vstup ignoruje
     void onKey(int key, int scancode, int action, int mods);
     void onMouseButton(int button, int action, int mods);
     void onCursorPos(double xpos, double ypos);
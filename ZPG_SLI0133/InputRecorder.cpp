@@ -0,0 +1,159 @@
+#include "InputRecorder.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+static const char* FILE_MAGIC = "zpg-input";
+static const int FILE_VERSION = 1;
+
+InputRecorder::InputRecorder(Mode mode, const std::string& path)
+    : m_Mode(mode), m_Path(path) {
+    if (m_Mode == Mode::Replay) {
+        load();
+    }
+}
+
+InputRecorder::~InputRecorder() {
+    if (m_Mode == Mode::Record && !m_Saved) {
+        save();
+    }
+}
+
+void InputRecorder::beginFrame(double deltaTime) {
+    Frame frame;
+    frame.deltaTime = deltaTime;
+    m_Frames.push_back(std::move(frame));
+}
+
+void InputRecorder::recordKeyDown(int key) {
+    if (m_Frames.empty()) return;
+    std::vector<int>& keys = m_Frames.back().keysDown;
+    if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+        keys.push_back(key);
+    }
+}
+
+void InputRecorder::recordEvent(const Event& event) {
+    // Callbacky chodi az z glfwPollEvents na konci snimku, predtim neni co zapsat
+    if (m_Frames.empty()) return;
+    m_Frames.back().events.push_back(event);
+}
+
+void InputRecorder::save() {
+    m_Saved = true;
+    std::ofstream file(m_Path);
+    if (!file) {
+        std::cerr << "Cannot write input recording: " << m_Path << std::endl;
+        return;
+    }
+
+    // Cas i kurzor s plnou presnosti double, jinak by se prehrani rozeslo
+    file.precision(std::numeric_limits<double>::max_digits10);
+    file << FILE_MAGIC << " " << FILE_VERSION << "\n";
+    file << "seed " << m_Seed << "\n";
+    file << "scene " << m_Scene << "\n";
+
+    for (const Frame& frame : m_Frames) {
+        file << "F " << frame.deltaTime;
+        for (int key : frame.keysDown) file << " " << key;
+        file << "\n";
+
+        for (const Event& event : frame.events) {
+            switch (event.type) {
+            case Event::KEY:
+                file << "K " << event.code << " " << event.scancode << " " << event.action << " " << event.mods << "\n";
+                break;
+            case Event::MOUSE_BUTTON:
+                file << "M " << event.code << " " << event.action << " " << event.mods << "\n";
+                break;
+            case Event::CURSOR:
+                file << "C " << event.x << " " << event.y << "\n";
+                break;
+            case Event::SCROLL:
+                file << "S " << event.x << " " << event.y << "\n";
+                break;
+            }
+        }
+    }
+    std::cout << "Input recording: " << m_Frames.size() << " frames -> " << m_Path << std::endl;
+}
+
+void InputRecorder::load() {
+    std::ifstream file(m_Path);
+    if (!file) {
+        throw std::runtime_error("Cannot open input recording: " + m_Path);
+    }
+
+    std::string magic;
+    int version = 0;
+    file >> magic >> version;
+    if (magic != FILE_MAGIC || version != FILE_VERSION) {
+        throw std::runtime_error("Unsupported input recording: " + m_Path);
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty()) continue;
+        std::istringstream in(line);
+        std::string tag;
+        in >> tag;
+
+        if (tag == "seed") {
+            in >> m_Seed;
+        }
+        else if (tag == "scene") {
+            in >> m_Scene;
+        }
+        else if (tag == "F") {
+            Frame frame;
+            in >> frame.deltaTime;
+            int key;
+            while (in >> key) frame.keysDown.push_back(key);
+            m_Frames.push_back(std::move(frame));
+        }
+        else if (!m_Frames.empty()) {
+            Event event;
+            if (tag == "K") {
+                event.type = Event::KEY;
+                in >> event.code >> event.scancode >> event.action >> event.mods;
+            }
+            else if (tag == "M") {
+                event.type = Event::MOUSE_BUTTON;
+                in >> event.code >> event.action >> event.mods;
+            }
+            else if (tag == "C" || tag == "S") {
+                event.type = (tag == "C") ? Event::CURSOR : Event::SCROLL;
+                in >> event.x >> event.y;
+            }
+            else {
+                throw std::runtime_error("Corrupted input recording: " + m_Path);
+            }
+            m_Frames.back().events.push_back(event);
+        }
+    }
+
+    std::cout << "Input replay: " << m_Frames.size() << " frames, seed " << m_Seed << ", scene " << m_Scene << std::endl;
+}
+
+bool InputRecorder::nextFrame(double& deltaTime) {
+    // m_Current ukazuje za prave prehravany snimek
+    if (m_Current >= m_Frames.size()) return false;
+    deltaTime = m_Frames[m_Current].deltaTime;
+    m_Current++;
+    return true;
+}
+
+bool InputRecorder::isKeyDown(int key) const {
+    if (m_Current == 0) return false;
+    const std::vector<int>& keys = m_Frames[m_Current - 1].keysDown;
+    return std::find(keys.begin(), keys.end(), key) != keys.end();
+}
+
+const std::vector<InputRecorder::Event>& InputRecorder::getFrameEvents() const {
+    static const std::vector<Event> none;
+    if (m_Current == 0) return none;
+    return m_Frames[m_Current - 1].events;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Zaznam vstupu po snimcich: delta cas snimku, klavesy drzene pri pollingu
+// a udalosti z GLFW callbacku, plus seed RNG a vychozi scena. Prehravani
+// posila stejne vstupy do InputControlleru, takze simulace probehne stejne.
+class InputRecorder {
+public:
+    enum class Mode {
+        Record,
+        Replay,
+    };
+
+    struct Event {
+        enum Type : uint8_t { KEY, MOUSE_BUTTON, CURSOR, SCROLL };
+        Type type;
+        int code = 0;      // klavesa / tlacitko
+        int scancode = 0;
+        int action = 0;
+        int mods = 0;
+        double x = 0.0;    // kurzor / scroll
+        double y = 0.0;
+    };
+
+    // Replay nacte soubor hned (vyjimka pri chybe), Record zapise v save()
+    InputRecorder(Mode mode, const std::string& path);
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    bool isRecording() const { return m_Mode == Mode::Record; }
+    bool isReplaying() const { return m_Mode == Mode::Replay; }
+
+    unsigned int getSeed() const { return m_Seed; }
+    int getScene() const { return m_Scene; }
+    void setSeed(unsigned int seed) { m_Seed = seed; }
+    void setScene(int scene) { m_Scene = scene; }
+
+    // Record
+    void beginFrame(double deltaTime);
+    void recordKeyDown(int key);
+    void recordEvent(const Event& event);
+    void save();
+
+    // Replay: false, kdyz zaznam dosel
+    bool nextFrame(double& deltaTime);
+    bool isKeyDown(int key) const;
+    const std::vector<Event>& getFrameEvents() const;
+
+    size_t getFrameCount() const { return m_Frames.size(); }
+
+private:
+    struct Frame {
+        double deltaTime = 0.0;
+        std::vector<int> keysDown;
+        std::vector<Event> events;
+    };
+
+    void load();
+
+    Mode m_Mode;
+    std::string m_Path;
+    unsigned int m_Seed = 0;
+    int m_Scene = 0;
+    std::vector<Frame> m_Frames;
+    size_t m_Current = 0;
+    bool m_Saved = false;
+};
@@ -0,0 +1,135 @@
+#include "LightGrid.h"
+#include <algorithm>
+#include <cmath>
+
+const int LightGrid::MAX_OBJECT_LIGHTS;
+const int LightGrid::MAX_CELLS_PER_LIGHT;
+
+uint64_t LightGrid::cellKey(int x, int y, int z) {
+    // 21 bitu na osu, posunuto do kladnych cisel
+    const uint64_t mask = (1u << 21) - 1;
+    return (((uint64_t)(x + (1 << 20)) & mask) << 42)
+        | (((uint64_t)(y + (1 << 20)) & mask) << 21)
+        | ((uint64_t)(z + (1 << 20)) & mask);
+}
+
+glm::ivec3 LightGrid::cellOf(const glm::vec3& position) const {
+    return glm::ivec3(glm::floor(position / m_CellSize));
+}
+
+void LightGrid::build(const std::vector<PointLight>& lights, int count) {
+    m_Lights.clear();
+    m_Entries.clear();
+    m_GlobalLights.clear();
+
+    float radiusSum = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const PointLight& light = lights[i];
+        LightInfo info;
+        info.position = light.position;
+        info.radius = light.getInfluenceRadius();
+        info.intensity = std::fmax(light.color.r, std::fmax(light.color.g, light.color.b));
+        info.constant = light.constant;
+        info.linear = light.linear;
+        info.quadratic = light.quadratic;
+        m_Lights.push_back(info);
+        radiusSum += info.radius;
+    }
+    if (m_Lights.empty()) return;
+
+    // Bunka zhruba velikosti prumerne koule dosahu: svetlo zabere par bunek
+    m_CellSize = std::max(radiusSum / (float)m_Lights.size(), 1.0f);
+
+    for (uint32_t i = 0; i < (uint32_t)m_Lights.size(); ++i) {
+        const LightInfo& light = m_Lights[i];
+        if (light.radius <= 0.0f) continue;
+
+        glm::ivec3 lo = cellOf(light.position - glm::vec3(light.radius));
+        glm::ivec3 hi = cellOf(light.position + glm::vec3(light.radius));
+        glm::ivec3 extent = hi - lo + glm::ivec3(1);
+        if ((int64_t)extent.x * extent.y * extent.z > MAX_CELLS_PER_LIGHT) {
+            m_GlobalLights.push_back(i);
+            continue;
+        }
+
+        for (int x = lo.x; x <= hi.x; ++x)
+            for (int y = lo.y; y <= hi.y; ++y)
+                for (int z = lo.z; z <= hi.z; ++z)
+                    m_Entries.push_back(std::make_pair(cellKey(x, y, z), i));
+    }
+    std::sort(m_Entries.begin(), m_Entries.end());
+
+    m_VisitStamp.assign(m_Lights.size(), 0);
+    m_QueryStamp = 0;
+}
+
+float LightGrid::significance(const LightInfo& light, const Bounds& bounds) const {
+    // Utlumena intenzita na nejblizsim bode koule objektu
+    float distance = std::fmax(glm::length(light.position - bounds.center) - bounds.radius, 0.0f);
+    return light.intensity / (light.constant + light.linear * distance + light.quadratic * distance * distance);
+}
+
+LightGrid::Selection LightGrid::select(const Bounds& bounds) const {
+    Selection selection;
+    float scores[MAX_OBJECT_LIGHTS];
+
+    auto consider = [&](uint32_t index) {
+        if (m_VisitStamp[index] == m_QueryStamp) return;
+        m_VisitStamp[index] = m_QueryStamp;
+
+        const LightInfo& light = m_Lights[index];
+        float reach = light.radius + bounds.radius;
+        glm::vec3 delta = light.position - bounds.center;
+        if (glm::dot(delta, delta) > reach * reach) return;
+
+        // Vlozeni do serazeneho top-N
+        float score = significance(light, bounds);
+        int slot = selection.count;
+        if (slot == MAX_OBJECT_LIGHTS) {
+            if (score <= scores[MAX_OBJECT_LIGHTS - 1]) return;
+            slot--;
+        }
+        else {
+            selection.count++;
+        }
+        while (slot > 0 && scores[slot - 1] < score) {
+            scores[slot] = scores[slot - 1];
+            selection.indices[slot] = selection.indices[slot - 1];
+            slot--;
+        }
+        scores[slot] = score;
+        selection.indices[slot] = (int)index;
+    };
+
+    if (m_Lights.empty()) return selection;
+    if (++m_QueryStamp == 0) {
+        std::fill(m_VisitStamp.begin(), m_VisitStamp.end(), 0u);
+        m_QueryStamp = 1;
+    }
+
+    for (uint32_t index : m_GlobalLights) {
+        consider(index);
+    }
+
+    glm::ivec3 lo = cellOf(bounds.center - glm::vec3(bounds.radius));
+    glm::ivec3 hi = cellOf(bounds.center + glm::vec3(bounds.radius));
+    glm::ivec3 extent = hi - lo + glm::ivec3(1);
+    if ((int64_t)extent.x * extent.y * extent.z > MAX_CELLS_PER_LIGHT) {
+        // Obri objekt (teren): levnejsi projit vsechna svetla
+        for (uint32_t index = 0; index < (uint32_t)m_Lights.size(); ++index) {
+            if (m_Lights[index].radius > 0.0f) consider(index);
+        }
+        return selection;
+    }
+
+    for (int x = lo.x; x <= hi.x; ++x)
+        for (int y = lo.y; y <= hi.y; ++y)
+            for (int z = lo.z; z <= hi.z; ++z) {
+                const uint64_t key = cellKey(x, y, z);
+                auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), std::make_pair(key, 0u));
+                for (; it != m_Entries.end() && it->first == key; ++it) {
+                    consider(it->second);
+                }
+            }
+    return selection;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Model.h"
+#include "PointLight.h"
+
+// Vyber bodovych svetel pro objekt: kazde svetlo ma kouli dosahu z utlumu
+// (PointLight::getInfluenceRadius) a je zapsane do bunek uniformni mrizky,
+// ktere koule prekryva. Dotaz vrati nejvyznamnejsi svetla prekryvajici objekt.
+class LightGrid {
+public:
+    // Pocet svetel na objekt (ivec4 u_LightIndices ve forward shaderu)
+    static const int MAX_OBJECT_LIGHTS = 4;
+
+    struct Selection {
+        int indices[MAX_OBJECT_LIGHTS] = {}; // neobsazene sloty 0, shader cte jen count
+        int count = 0;
+    };
+
+    // Prestavi mrizku z prvnich count svetel; volat jednou za snimek po pohybu svetel
+    void build(const std::vector<PointLight>& lights, int count);
+
+    Selection select(const Bounds& bounds) const;
+
+    float getCellSize() const { return m_CellSize; }
+    size_t getCellEntryCount() const { return m_Entries.size(); }
+
+private:
+    // Svetlo, ktere by zabralo vic bunek, se testuje proti vsem objektum
+    static const int MAX_CELLS_PER_LIGHT = 512;
+
+    struct LightInfo {
+        glm::vec3 position;
+        float radius;
+        float intensity;
+        float constant;
+        float linear;
+        float quadratic;
+    };
+
+    static uint64_t cellKey(int x, int y, int z);
+    glm::ivec3 cellOf(const glm::vec3& position) const;
+    float significance(const LightInfo& light, const Bounds& bounds) const;
+
+    std::vector<LightInfo> m_Lights;
+    // (klic bunky, index svetla), serazeno podle klice
+    std::vector<std::pair<uint64_t, uint32_t>> m_Entries;
+    std::vector<uint32_t> m_GlobalLights;
+    float m_CellSize = 1.0f;
+
+    // Oznaceni uz testovanych svetel behem jednoho dotazu
+    mutable std::vector<uint32_t> m_VisitStamp;
+    mutable uint32_t m_QueryStamp = 0;
+};
@@ -0,0 +1,103 @@
+#include "LightStorage.h"
+#include "RenderStats.h"
+#include "RenderDevice.h"
+#include <algorithm>
+
+// Rozlozeni musi odpovidat std140 bloku v shaderech
+static_assert(sizeof(DirLight) == 32, "DirLight must match std140 layout");
+static_assert(sizeof(PointLight) == 48, "PointLight must match std140 layout");
+static_assert(sizeof(SpotLight) == 64, "SpotLight must match std140 layout");
+static_assert(offsetof(LightBlock, flashlight) == 16, "LightBlock layout mismatch");
+static_assert(offsetof(LightBlock, dirLights) == 80, "LightBlock layout mismatch");
+static_assert(offsetof(LightBlock, pointLights) == 80 + 32 * LightBlock::MAX_DIR_LIGHTS, "LightBlock layout mismatch");
+static_assert(offsetof(LightBlock, spotLights) % 16 == 0, "LightBlock layout mismatch");
+
+const int LightBlock::MAX_DIR_LIGHTS;
+const int LightBlock::MAX_POINT_LIGHTS;
+const int LightBlock::MAX_SPOT_LIGHTS;
+const GLuint LightStorage::BLOCK_BINDING;
+
+LightStorage::LightStorage() {
+}
+
+LightStorage::~LightStorage() {
+    if (m_UBO != 0) {
+        RenderDevice::get().deleteBuffer(m_UBO);
+        RenderStats::get().addBufferMemory(-(int64_t)sizeof(LightBlock));
+    }
+}
+
+LightHandle LightStorage::addDirLight(const DirLight& light) {
+    m_DirLights.push_back(light);
+    m_Changed = true;
+    return static_cast<LightHandle>(m_DirLights.size() - 1);
+}
+
+LightHandle LightStorage::addPointLight(const PointLight& light) {
+    m_PointLights.push_back(light);
+    m_Changed = true;
+    return static_cast<LightHandle>(m_PointLights.size() - 1);
+}
+
+LightHandle LightStorage::addSpotLight(const SpotLight& light) {
+    m_SpotLights.push_back(light);
+    m_Changed = true;
+    return static_cast<LightHandle>(m_SpotLights.size() - 1);
+}
+
+void LightStorage::clear() {
+    m_DirLights.clear();
+    m_PointLights.clear();
+    m_SpotLights.clear();
+    m_Changed = true;
+}
+
+int LightStorage::getDirLightCount() const {
+    return std::min((int)m_DirLights.size(), LightBlock::MAX_DIR_LIGHTS);
+}
+
+int LightStorage::getPointLightCount() const {
+    return std::min((int)m_PointLights.size(), LightBlock::MAX_POINT_LIGHTS);
+}
+
+int LightStorage::getSpotLightCount() const {
+    return std::min((int)m_SpotLights.size(), LightBlock::MAX_SPOT_LIGHTS);
+}
+
+void LightStorage::upload(const glm::vec3& ambient, const SpotLight& flashlight) {
+    RenderDevice& device = RenderDevice::get();
+    if (m_UBO == 0) {
+        m_UBO = device.genBuffer();
+        device.bindBuffer(GL_UNIFORM_BUFFER, m_UBO);
+        device.bufferData(GL_UNIFORM_BUFFER, sizeof(LightBlock), nullptr, GL_DYNAMIC_DRAW);
+        device.bindBufferBase(GL_UNIFORM_BUFFER, BLOCK_BINDING, m_UBO);
+        RenderStats::get().addBufferMemory((int64_t)sizeof(LightBlock));
+    }
+    device.bindBuffer(GL_UNIFORM_BUFFER, m_UBO);
+
+    // Hlavicka bloku a pak kazde pole jednim kopirovanim; zbytek poli shader necte (NUM_*_LIGHTS)
+    const glm::vec4 ambient4(ambient, 0.0f);
+    device.bufferSubData(GL_UNIFORM_BUFFER, offsetof(LightBlock, ambient), sizeof(glm::vec4), &ambient4);
+    device.bufferSubData(GL_UNIFORM_BUFFER, offsetof(LightBlock, flashlight), sizeof(SpotLight), &flashlight);
+    size_t uploaded = sizeof(glm::vec4) + sizeof(SpotLight);
+    if (int count = getDirLightCount()) {
+        device.bufferSubData(GL_UNIFORM_BUFFER, offsetof(LightBlock, dirLights), count * sizeof(DirLight), m_DirLights.data());
+        uploaded += count * sizeof(DirLight);
+    }
+    if (int count = getPointLightCount()) {
+        device.bufferSubData(GL_UNIFORM_BUFFER, offsetof(LightBlock, pointLights), count * sizeof(PointLight), m_PointLights.data());
+        uploaded += count * sizeof(PointLight);
+    }
+    if (int count = getSpotLightCount()) {
+        device.bufferSubData(GL_UNIFORM_BUFFER, offsetof(LightBlock, spotLights), count * sizeof(SpotLight), m_SpotLights.data());
+        uploaded += count * sizeof(SpotLight);
+    }
+    device.bindBuffer(GL_UNIFORM_BUFFER, 0);
+    RenderStats::get().countUpload(uploaded);
+}
+
+std::string LightStorage::getBlockDefines() {
+    return "#define MAX_DIR_LIGHTS " + std::to_string(LightBlock::MAX_DIR_LIGHTS) + "\n"
+        + "#define MAX_POINT_LIGHTS " + std::to_string(LightBlock::MAX_POINT_LIGHTS) + "\n"
+        + "#define MAX_SPOT_LIGHTS " + std::to_string(LightBlock::MAX_SPOT_LIGHTS) + "\n";
+}
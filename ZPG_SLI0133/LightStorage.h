@@ -0,0 +1,78 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Lights.h"
+
+// Index do pole svetel daneho typu; svetla se neodebiraji jednotlive, jen clear()
+using LightHandle = uint32_t;
+
+// Obraz uniform bloku LightBlock (std140) ve vsech osvetlovacich shaderech
+struct LightBlock {
+    static const int MAX_DIR_LIGHTS = 2;
+    // Forward shader z nich na objekt cte jen LightGrid::MAX_OBJECT_LIGHTS
+    static const int MAX_POINT_LIGHTS = 256; // cely blok ~12.4 KB, pod minimem 16 KB
+    static const int MAX_SPOT_LIGHTS = 4;
+
+    glm::vec4 ambient;
+    SpotLight flashlight;
+    DirLight dirLights[MAX_DIR_LIGHTS];
+    PointLight pointLights[MAX_POINT_LIGHTS];
+    SpotLight spotLights[MAX_SPOT_LIGHTS];
+};
+
+// Svetla sceny v souvislych polich podle typu, bez virtualnich metod.
+// Pole maji std140 rozlozeni a do uniform bufferu se kopiruji primo.
+class LightStorage {
+public:
+    static const GLuint BLOCK_BINDING = 0;
+
+    LightStorage();
+    ~LightStorage();
+
+    LightStorage(const LightStorage&) = delete;
+    LightStorage& operator=(const LightStorage&) = delete;
+
+    LightHandle addDirLight(const DirLight& light);
+    LightHandle addPointLight(const PointLight& light);
+    LightHandle addSpotLight(const SpotLight& light);
+    void clear();
+
+    // Zapis pres vracenou referenci se bere jako zmena svetla
+    DirLight& dirLight(LightHandle handle) { m_Changed = true; return m_DirLights[handle]; }
+    PointLight& pointLight(LightHandle handle) { m_Changed = true; return m_PointLights[handle]; }
+    SpotLight& spotLight(LightHandle handle) { m_Changed = true; return m_SpotLights[handle]; }
+
+    const std::vector<DirLight>& getDirLights() const { return m_DirLights; }
+    const std::vector<PointLight>& getPointLights() const { return m_PointLights; }
+    const std::vector<SpotLight>& getSpotLights() const { return m_SpotLights; }
+
+    // Pocty svetel, ktere se vejdou do bloku
+    int getDirLightCount() const;
+    int getPointLightCount() const;
+    int getSpotLightCount() const;
+
+    // Nahraje svetla do UBO na BLOCK_BINDING; jednou za snimek pred kreslenim
+    void upload(const glm::vec3& ambient, const SpotLight& flashlight);
+
+    // On-demand kresleni: pridani nebo zmena svetla od posledniho dotazu
+    bool consumeChanged() {
+        bool changed = m_Changed;
+        m_Changed = false;
+        return changed;
+    }
+
+    // #define MAX_*_LIGHTS pro shadery, aby velikosti poli sedely s LightBlock
+    static std::string getBlockDefines();
+
+private:
+    std::vector<DirLight> m_DirLights;
+    std::vector<PointLight> m_PointLights;
+    std::vector<SpotLight> m_SpotLights;
+
+    GLuint m_UBO = 0;
+    bool m_Changed = true;
+};
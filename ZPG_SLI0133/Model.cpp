@@ -2,11 +2,17 @@
 #include <iostream>
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
+#include <cmath>
 #include "tiny_obj_loader.h" 
+#include "Profiler.h"
+#include "RenderStats.h"
+#include "RenderDevice.h"
 
 Model::Model(const float* points, size_t size, int stride, GLint mode)
     : gleumMode(mode), m_Stride(stride)
 {
+    ZPG_PROFILE_SCOPE("Model load (vertices)");
     this->count = static_cast<int>(size / sizeof(float) / m_Stride);
 
     if (size == 0 || count == 0) {
@@ -17,34 +23,64 @@ Model::Model(const float* points, size_t size, int stride, GLint mode)
             << ", Pocet vertexu ('count'): " << count << ", Stride: " << m_Stride << std::endl;
     }
 
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, size, points, GL_STATIC_DRAW);
+    computeBounds(points);
 
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    createBuffers(points, size);
+}
+
+Model::Model(const char* name)
+    : vao(0), vbo(0), gleumMode(GL_TRIANGLES), count(0), m_Stride(0)
+{
+    ZPG_PROFILE_SCOPE("Model load (obj)");
+    std::vector<float> vertices;
+    m_Stride = loadObjVertices(name, vertices);
+
+    if (vertices.empty()) {
+        std::cerr << "Model " << name << " neobsahuje zadne vertexy." << std::endl;
+        return;
+    }
+
+    this->count = static_cast<int>(vertices.size()) / m_Stride;
+
+    std::cout << "Model z OBJ nahran: " << name
+        << ", Pocet vertexu ('count'): " << this->count << ", Stride: " << m_Stride << std::endl;
+
+    computeBounds(vertices.data());
+
+    createBuffers(vertices.data(), vertices.size() * sizeof(float));
+}
+
+void Model::createBuffers(const float* vertices, size_t size) {
+    RenderDevice& device = RenderDevice::get();
+    vbo = device.genBuffer();
+    device.bindBuffer(GL_ARRAY_BUFFER, vbo);
+    device.bufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+    m_BufferBytes = size;
+    RenderStats::get().countUpload(m_BufferBytes);
+    RenderStats::get().addBufferMemory((int64_t)m_BufferBytes);
+
+    vao = device.genVertexArray();
+    device.bindVertexArray(vao);
+    device.bindBuffer(GL_ARRAY_BUFFER, vbo);
 
     int stride_bytes = m_Stride * sizeof(float);
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)0);
+    device.enableVertexAttribArray(0);
+    device.vertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride_bytes, 0);
 
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)(3 * sizeof(float)));
+    device.enableVertexAttribArray(1);
+    device.vertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride_bytes, 3 * sizeof(float));
 
     if (m_Stride == 8) {
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)(6 * sizeof(float)));
+        device.enableVertexAttribArray(2);
+        device.vertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride_bytes, 6 * sizeof(float));
     }
 
-    glBindVertexArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    device.bindVertexArray(0);
+    device.bindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-Model::Model(const char* name)
-    : gleumMode(GL_TRIANGLES), count(0), m_Stride(0)
-{
+int Model::loadObjVertices(const char* name, std::vector<float>& vertices) {
     std::string inputfile = name;
     tinyobj::attrib_t attrib;
     std::vector<tinyobj::shape_t> shapes;
@@ -56,9 +92,9 @@ Model::Model(const char* name)
     if (!err.empty()) std::cerr << "Err: " << err << std::endl;
     if (!ret) throw std::runtime_error("Failed to load OBJ file!");
 
-    std::vector<float> vertices;
     bool hasUVs = !attrib.texcoords.empty();
-    m_Stride = hasUVs ? 8 : 6;
+    int stride = hasUVs ? 8 : 6;
+    vertices.clear();
 
     for (const auto& shape : shapes) {
         for (const auto& index : shape.mesh.indices) {
@@ -77,7 +113,7 @@ Model::Model(const char* name)
                 vertices.push_back(0.0f);
             }
 
-            if (m_Stride == 8) {
+            if (stride == 8) {
                 if (index.texcoord_index >= 0) {
                     vertices.push_back(attrib.texcoords[2 * index.texcoord_index + 0]);
                     vertices.push_back(attrib.texcoords[2 * index.texcoord_index + 1]);
@@ -90,49 +126,41 @@ Model::Model(const char* name)
         }
     }
 
-    if (vertices.empty()) {
-        std::cerr << "Model " << name << " neobsahuje zadne vertexy." << std::endl;
-        return;
-    }
-
-    this->count = static_cast<int>(vertices.size()) / m_Stride;
-
-    std::cout << "Model z OBJ nahran: " << name
-        << ", Pocet vertexu ('count'): " << this->count << ", Stride: " << m_Stride << std::endl;
-
-    glGenBuffers(1, &vbo);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), vertices.data(), GL_STATIC_DRAW);
-
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-
-    int stride_bytes = m_Stride * sizeof(float);
-
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)0);
+    return stride;
+}
 
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)(3 * sizeof(float)));
+void Model::computeBounds(const float* vertices) {
+    if (count <= 0) return;
 
-    if (m_Stride == 8) {
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride_bytes, (GLvoid*)(6 * sizeof(float)));
+    glm::vec3 minPos(vertices[0], vertices[1], vertices[2]);
+    glm::vec3 maxPos = minPos;
+    for (int i = 1; i < count; ++i) {
+        const float* p = vertices + i * m_Stride;
+        minPos = glm::min(minPos, glm::vec3(p[0], p[1], p[2]));
+        maxPos = glm::max(maxPos, glm::vec3(p[0], p[1], p[2]));
     }
 
-    glBindVertexArray(0);
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    m_Bounds.center = (minPos + maxPos) * 0.5f;
+    float radiusSq = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        const float* p = vertices + i * m_Stride;
+        glm::vec3 d = glm::vec3(p[0], p[1], p[2]) - m_Bounds.center;
+        radiusSq = std::max(radiusSq, glm::dot(d, d));
+    }
+    m_Bounds.radius = std::sqrt(radiusSq);
 }
 
-
 Model::~Model() {
-    glDeleteBuffers(1, &vbo);
-    glDeleteVertexArrays(1, &vao);
+    RenderDevice::get().deleteBuffer(vbo);
+    RenderDevice::get().deleteVertexArray(vao);
+    RenderStats::get().addBufferMemory(-(int64_t)m_BufferBytes);
 }
 
 void Model::draw() const {
-    glBindVertexArray(vao);
-    glDrawArrays(gleumMode, 0, count);
-    glBindVertexArray(0);
+    RenderDevice& device = RenderDevice::get();
+    device.bindVertexArray(vao);
+    device.drawArrays(gleumMode, 0, count);
+    RenderStats::get().countVaoBind();
+    RenderStats::get().countDraw(gleumMode, count);
+    device.bindVertexArray(0);
 }
\ No newline at end of file
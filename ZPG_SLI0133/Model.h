@@ -1,6 +1,14 @@
 #pragma once
 #include <GL/glew.h>
 #include <cstddef>
+#include <vector>
+#include <glm/glm.hpp>
+
+// Bounding sphere v lokalnich souradnicich modelu
+struct Bounds {
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+};
 
 class Model {
 private:
@@ -8,10 +16,21 @@ private:
     GLint gleumMode;
     int count;
     int m_Stride; 
+    Bounds m_Bounds;
+    size_t m_BufferBytes = 0; // pro odhad GPU pameti (RenderStats)
+
+    void computeBounds(const float* vertices);
+    void createBuffers(const float* vertices, size_t size);
 
 public:
     Model(const float* points, size_t size, int stride, GLint mode = GL_TRIANGLES);
     Model(const char* name);
     ~Model();
     void draw() const;
+
+    const Bounds& getBounds() const { return m_Bounds; }
+
+    // Nacte OBJ a rozvine indexy na pole vertexu (pozice, normala[, uv]); bez GL.
+    // Vraci stride (6 nebo 8)
+    static int loadObjVertices(const char* name, std::vector<float>& vertices);
 };
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include "NullRenderDevice.h"
+
+NullRenderDevice::NullRenderDevice(int viewportWidth, int viewportHeight)
+    : m_ViewportWidth(viewportWidth), m_ViewportHeight(viewportHeight) {
+}
+
+void NullRenderDevice::reset() {
+    m_Commands.clear();
+    m_Counters = NullDeviceCounters();
+}
+
+void NullRenderDevice::record(RenderCommandType type, GLenum target, uint32_t value, uint32_t count) {
+    if (!m_Recording) return;
+    RenderCommand command;
+    command.type = type;
+    command.target = target;
+    command.value = value;
+    command.count = count;
+    m_Commands.push_back(command);
+}
+
+void NullRenderDevice::countUniform(GLint location) {
+    m_Counters.uniformCalls++;
+    record(RenderCommandType::Uniform, m_Program, (uint32_t)location);
+}
+
+void NullRenderDevice::countState(GLenum name, bool changed, uint32_t value) {
+    m_Counters.stateCalls++;
+    if (!changed) return;
+    m_Counters.stateChanges++;
+    record(RenderCommandType::StateChange, name, value);
+}
+
+GLuint NullRenderDevice::genBuffer() {
+    m_LiveBuffers++;
+    return m_NextHandle++;
+}
+
+void NullRenderDevice::deleteBuffer(GLuint buffer) {
+    if (buffer != 0) m_LiveBuffers--;
+}
+
+void NullRenderDevice::bindBuffer(GLenum /*target*/, GLuint /*buffer*/) {
+}
+
+void NullRenderDevice::bindBufferBase(GLenum /*target*/, GLuint /*index*/, GLuint /*buffer*/) {
+}
+
+void NullRenderDevice::bufferData(GLenum target, size_t size, const void* data, GLenum /*usage*/) {
+    // Bez dat se jen alokuje, nic se neposila
+    if (!data) return;
+    m_Counters.uploadBytes += size;
+    record(RenderCommandType::Upload, target, 0, (uint32_t)size);
+}
+
+void NullRenderDevice::bufferSubData(GLenum target, size_t offset, size_t size, const void* /*data*/) {
+    m_Counters.uploadBytes += size;
+    record(RenderCommandType::Upload, target, (uint32_t)offset, (uint32_t)size);
+}
+
+GLuint NullRenderDevice::genVertexArray() {
+    m_LiveVertexArrays++;
+    return m_NextHandle++;
+}
+
+void NullRenderDevice::deleteVertexArray(GLuint vao) {
+    if (vao == 0) return;
+    m_LiveVertexArrays--;
+    if (m_VertexArray == vao) m_VertexArray = 0;
+}
+
+void NullRenderDevice::bindVertexArray(GLuint vao) {
+    m_Counters.vaoCalls++;
+    if (vao == m_VertexArray) return;
+    m_Counters.vaoChanges++;
+    m_VertexArray = vao;
+    record(RenderCommandType::BindVertexArray, GL_VERTEX_ARRAY, vao);
+}
+
+GLuint NullRenderDevice::genTexture() {
+    m_LiveTextures++;
+    return m_NextHandle++;
+}
+
+void NullRenderDevice::deleteTexture(GLuint texture) {
+    if (texture == 0) return;
+    m_LiveTextures--;
+    for (GLuint& bound : m_Textures) {
+        if (bound == texture) bound = 0;
+    }
+}
+
+void NullRenderDevice::activeTexture(GLenum unit) {
+    m_ActiveUnit = (unit - GL_TEXTURE0) % TEXTURE_UNITS;
+}
+
+void NullRenderDevice::bindTexture(GLenum target, GLuint texture) {
+    // Jeden slot na jednotku: scena nikdy nema na stejne jednotce 2D i cubemapu zaroven
+    m_Counters.textureCalls++;
+    if (m_Textures[m_ActiveUnit] == texture) return;
+    m_Counters.textureChanges++;
+    m_Textures[m_ActiveUnit] = texture;
+    record(RenderCommandType::BindTexture, target, texture, m_ActiveUnit);
+}
+
+void NullRenderDevice::texImage2D(GLenum target, GLint level, GLint /*internalFormat*/, GLsizei width, GLsizei height,
+    GLenum format, GLenum type, const void* data) {
+    if (!data) return;
+    size_t channels = format == GL_RED ? 1 : format == GL_RG ? 2 : format == GL_RGB ? 3 : 4;
+    size_t bytes = (size_t)width * (size_t)height * channels * (type == GL_FLOAT ? 4 : 1);
+    m_Counters.uploadBytes += bytes;
+    record(RenderCommandType::Upload, target, (uint32_t)level, (uint32_t)bytes);
+}
+
+GLint NullRenderDevice::getShaderi(GLuint /*shader*/, GLenum name) {
+    return name == GL_INFO_LOG_LENGTH ? 0 : GL_TRUE;
+}
+
+GLuint NullRenderDevice::createProgram() {
+    m_LivePrograms++;
+    return m_NextHandle++;
+}
+
+void NullRenderDevice::deleteProgram(GLuint program) {
+    if (program == 0) return;
+    m_LivePrograms--;
+    if (m_Program == program) m_Program = 0;
+}
+
+GLint NullRenderDevice::getProgrami(GLuint /*program*/, GLenum name) {
+    // GL_LINK_STATUS, GL_COMPLETION_STATUS_KHR: vzdy hotovo
+    return name == GL_INFO_LOG_LENGTH ? 0 : GL_TRUE;
+}
+
+GLint NullRenderDevice::getUniformLocation(GLuint /*program*/, const char* name) {
+    // Stejny nazev ma ve vsech programech stejnou lokaci
+    auto it = m_UniformLocations.find(name);
+    if (it != m_UniformLocations.end()) return it->second;
+    GLint location = (GLint)m_UniformLocations.size();
+    m_UniformLocations.emplace(name, location);
+    return location;
+}
+
+void NullRenderDevice::useProgram(GLuint program) {
+    m_Counters.programCalls++;
+    if (program == m_Program) return;
+    m_Counters.programChanges++;
+    m_Program = program;
+    record(RenderCommandType::UseProgram, GL_CURRENT_PROGRAM, program);
+}
+
+void NullRenderDevice::setCapability(GLenum capability, bool enabled) {
+    for (auto& entry : m_Capabilities) {
+        if (entry.first == capability) {
+            const bool changed = entry.second != enabled;
+            entry.second = enabled;
+            countState(capability, changed, enabled ? 1u : 0u);
+            return;
+        }
+    }
+    // Vychozi stav GL: vse vypnute
+    m_Capabilities.push_back(std::make_pair(capability, enabled));
+    countState(capability, enabled, enabled ? 1u : 0u);
+}
+
+void NullRenderDevice::enable(GLenum capability) {
+    setCapability(capability, true);
+}
+
+void NullRenderDevice::disable(GLenum capability) {
+    setCapability(capability, false);
+}
+
+void NullRenderDevice::depthFunc(GLenum func) {
+    const bool changed = m_DepthFunc != func;
+    m_DepthFunc = func;
+    countState(GL_DEPTH_FUNC, changed, func);
+}
+
+void NullRenderDevice::depthMask(GLboolean enabled) {
+    const bool changed = m_DepthMask != enabled;
+    m_DepthMask = enabled;
+    countState(GL_DEPTH_WRITEMASK, changed, enabled);
+}
+
+void NullRenderDevice::colorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+    const uint32_t mask = (r ? 1u : 0u) | (g ? 2u : 0u) | (b ? 4u : 0u) | (a ? 8u : 0u);
+    const bool changed = m_ColorMask != mask;
+    m_ColorMask = mask;
+    countState(GL_COLOR_WRITEMASK, changed, mask);
+}
+
+void NullRenderDevice::stencilFunc(GLenum func, GLint ref, GLuint mask) {
+    const bool changed = m_StencilFunc != func || m_StencilRef != (uint32_t)ref || m_StencilValueMask != mask;
+    m_StencilFunc = func;
+    m_StencilRef = (uint32_t)ref;
+    m_StencilValueMask = mask;
+    countState(GL_STENCIL_FUNC, changed, (uint32_t)ref);
+}
+
+void NullRenderDevice::stencilOp(GLenum stencilFail, GLenum depthFail, GLenum pass) {
+    const bool changed = m_StencilFail != stencilFail || m_StencilDepthFail != depthFail || m_StencilPass != pass;
+    m_StencilFail = stencilFail;
+    m_StencilDepthFail = depthFail;
+    m_StencilPass = pass;
+    countState(GL_STENCIL_PASS_DEPTH_PASS, changed, pass);
+}
+
+void NullRenderDevice::stencilMask(GLuint mask) {
+    const bool changed = m_StencilMask != mask;
+    m_StencilMask = mask;
+    countState(GL_STENCIL_WRITEMASK, changed, mask);
+}
+
+void NullRenderDevice::getViewport(GLint viewport[4]) {
+    viewport[0] = 0;
+    viewport[1] = 0;
+    viewport[2] = m_ViewportWidth;
+    viewport[3] = m_ViewportHeight;
+}
+
+void NullRenderDevice::drawArrays(GLenum mode, GLint /*first*/, GLsizei count) {
+    m_Counters.draws++;
+    m_Counters.vertices += (uint64_t)count;
+    record(RenderCommandType::Draw, mode, m_VertexArray, (uint32_t)count);
+}
+
+void NullRenderDevice::genQueries(GLsizei count, GLuint* queries) {
+    for (GLsizei i = 0; i < count; ++i) {
+        queries[i] = m_NextHandle++;
+    }
+}
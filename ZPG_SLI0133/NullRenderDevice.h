@@ -0,0 +1,173 @@
+#pragma once
+#include "RenderDevice.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+enum class RenderCommandType : uint8_t {
+    UseProgram,      // value = program
+    BindVertexArray, // value = VAO
+    BindTexture,     // target, value = textura, count = jednotka
+    Uniform,         // target = program, value = location
+    Upload,          // target = cil bufferu/textury, count = bajty
+    StateChange,     // target = GL_DEPTH_FUNC, GL_STENCIL_TEST, ..., value = nova hodnota
+    Draw,            // target = mode, value = VAO, count = pocet vertexu
+};
+
+struct RenderCommand {
+    RenderCommandType type;
+    GLenum target;
+    uint32_t value;
+    uint32_t count;
+};
+
+// *Calls = vsechna volani, *Changes = jen ta, ktera stav opravdu zmenila
+struct NullDeviceCounters {
+    uint64_t draws = 0;
+    uint64_t vertices = 0;
+    uint64_t programCalls = 0;
+    uint64_t programChanges = 0;
+    uint64_t vaoCalls = 0;
+    uint64_t vaoChanges = 0;
+    uint64_t textureCalls = 0;
+    uint64_t textureChanges = 0;
+    uint64_t stateCalls = 0;
+    uint64_t stateChanges = 0;
+    uint64_t uniformCalls = 0;
+    uint64_t uploadBytes = 0;
+};
+
+// Zarizeni bez GPU: vraci umele handly, prekladu a linku vzdy uspeji, dotazy maji
+// vysledek 0. Drzi stinovou kopii GL stavu, aby slo rozlisit zbytecne bindy.
+// Zaznam prikazu je vychozi vypnuty (setRecording), pocitadla bezi vzdy.
+class NullRenderDevice : public RenderDevice {
+public:
+    explicit NullRenderDevice(int viewportWidth = 1024, int viewportHeight = 768);
+
+    bool isNull() const override { return true; }
+
+    void setViewport(int width, int height) { m_ViewportWidth = width; m_ViewportHeight = height; }
+
+    void setRecording(bool recording) { m_Recording = recording; }
+    const std::vector<RenderCommand>& getCommands() const { return m_Commands; }
+    const NullDeviceCounters& getCounters() const { return m_Counters; }
+    // Smaze zaznam a pocitadla; stav a zive objekty zustavaji
+    void reset();
+
+    // Zive objekty (kontrola uniku v testech)
+    int getLiveBuffers() const { return m_LiveBuffers; }
+    int getLiveVertexArrays() const { return m_LiveVertexArrays; }
+    int getLiveTextures() const { return m_LiveTextures; }
+    int getLivePrograms() const { return m_LivePrograms; }
+
+    GLuint genBuffer() override;
+    void deleteBuffer(GLuint buffer) override;
+    void bindBuffer(GLenum target, GLuint buffer) override;
+    void bindBufferBase(GLenum target, GLuint index, GLuint buffer) override;
+    void bufferData(GLenum target, size_t size, const void* data, GLenum usage) override;
+    void bufferSubData(GLenum target, size_t offset, size_t size, const void* data) override;
+
+    GLuint genVertexArray() override;
+    void deleteVertexArray(GLuint vao) override;
+    void bindVertexArray(GLuint vao) override;
+    void enableVertexAttribArray(GLuint /*index*/) override {}
+    void vertexAttribPointer(GLuint /*index*/, GLint /*size*/, GLenum /*type*/, GLboolean /*normalized*/, GLsizei /*stride*/, size_t /*offset*/) override {}
+
+    GLuint genTexture() override;
+    void deleteTexture(GLuint texture) override;
+    void activeTexture(GLenum unit) override;
+    void bindTexture(GLenum target, GLuint texture) override;
+    void texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height,
+        GLenum format, GLenum type, const void* data) override;
+    void texParameteri(GLenum /*target*/, GLenum /*name*/, GLint /*value*/) override {}
+    void generateMipmap(GLenum /*target*/) override {}
+
+    GLuint createShader(GLenum /*type*/) override { return m_NextHandle++; }
+    void deleteShader(GLuint /*shader*/) override {}
+    void shaderSource(GLuint /*shader*/, const char* /*source*/) override {}
+    void compileShader(GLuint /*shader*/) override {}
+    GLint getShaderi(GLuint shader, GLenum name) override;
+    std::string getShaderInfoLog(GLuint /*shader*/) override { return std::string(); }
+
+    GLuint createProgram() override;
+    void deleteProgram(GLuint program) override;
+    void attachShader(GLuint /*program*/, GLuint /*shader*/) override {}
+    void programParameteri(GLuint /*program*/, GLenum /*name*/, GLint /*value*/) override {}
+    void linkProgram(GLuint /*program*/) override {}
+    GLint getProgrami(GLuint program, GLenum name) override;
+    std::string getProgramInfoLog(GLuint /*program*/) override { return std::string(); }
+    GLint getUniformLocation(GLuint program, const char* name) override;
+    GLuint getUniformBlockIndex(GLuint /*program*/, const char* /*name*/) override { return GL_INVALID_INDEX; }
+    void uniformBlockBinding(GLuint /*program*/, GLuint /*blockIndex*/, GLuint /*binding*/) override {}
+    void useProgram(GLuint program) override;
+
+    void uniform(GLint location, int /*value*/) override { countUniform(location); }
+    void uniform(GLint location, float /*value*/) override { countUniform(location); }
+    void uniform(GLint location, const glm::vec3& /*value*/) override { countUniform(location); }
+    void uniform(GLint location, const glm::vec4& /*value*/) override { countUniform(location); }
+    void uniform(GLint location, const glm::ivec4& /*value*/) override { countUniform(location); }
+    void uniform(GLint location, const glm::mat3& /*value*/) override { countUniform(location); }
+    void uniform(GLint location, const glm::mat4& /*value*/) override { countUniform(location); }
+
+    void enable(GLenum capability) override;
+    void disable(GLenum capability) override;
+    void depthFunc(GLenum func) override;
+    void depthMask(GLboolean enabled) override;
+    void colorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) override;
+    void stencilFunc(GLenum func, GLint ref, GLuint mask) override;
+    void stencilOp(GLenum stencilFail, GLenum depthFail, GLenum pass) override;
+    void stencilMask(GLuint mask) override;
+    void getViewport(GLint viewport[4]) override;
+
+    void drawArrays(GLenum mode, GLint first, GLsizei count) override;
+
+    void genQueries(GLsizei count, GLuint* queries) override;
+    void deleteQueries(GLsizei /*count*/, const GLuint* /*queries*/) override {}
+    void beginQuery(GLenum /*target*/, GLuint /*query*/) override {}
+    void endQuery(GLenum /*target*/) override {}
+    bool isQueryResultAvailable(GLuint /*query*/) override { return true; }
+    GLuint64 getQueryResult(GLuint /*query*/) override { return 0; }
+
+private:
+    static const int TEXTURE_UNITS = 32;
+
+    void record(RenderCommandType type, GLenum target, uint32_t value, uint32_t count = 0);
+    void countUniform(GLint location);
+    // name = GL nazev stavu (GL_DEPTH_FUNC, ...), value = nova hodnota do zaznamu
+    void countState(GLenum name, bool changed, uint32_t value);
+    void setCapability(GLenum capability, bool enabled);
+
+    GLuint m_NextHandle = 1;
+    int m_ViewportWidth;
+    int m_ViewportHeight;
+
+    bool m_Recording = false;
+    std::vector<RenderCommand> m_Commands;
+    NullDeviceCounters m_Counters;
+
+    // Stinovy stav
+    GLuint m_Program = 0;
+    GLuint m_VertexArray = 0;
+    GLuint m_ActiveUnit = 0;
+    GLuint m_Textures[TEXTURE_UNITS] = {};
+    std::vector<std::pair<GLenum, bool>> m_Capabilities;
+    uint32_t m_DepthFunc = GL_LESS;
+    uint32_t m_DepthMask = GL_TRUE;
+    uint32_t m_ColorMask = 0xF;
+    uint32_t m_StencilFunc = GL_ALWAYS;
+    uint32_t m_StencilRef = 0;
+    uint32_t m_StencilValueMask = 0xFFFFFFFFu;
+    uint32_t m_StencilFail = GL_KEEP;
+    uint32_t m_StencilDepthFail = GL_KEEP;
+    uint32_t m_StencilPass = GL_KEEP;
+    uint32_t m_StencilMask = 0xFFFFFFFFu;
+
+    std::unordered_map<std::string, GLint> m_UniformLocations;
+
+    int m_LiveBuffers = 0;
+    int m_LiveVertexArrays = 0;
+    int m_LiveTextures = 0;
+    int m_LivePrograms = 0;
+};
@@ -0,0 +1,262 @@
+#include "ObjectStorage.h"
+#include "Material.h"
+#include <algorithm>
+#include <cmath>
+
+const uint32_t ObjectStorage::INVALID_INDEX;
+const MaterialHandle ObjectStorage::DEFAULT_MATERIAL;
+
+ObjectStorage::ObjectStorage() {
+    clear();
+}
+
+ObjectStorage::~ObjectStorage() {
+}
+
+MeshHandle ObjectStorage::addMesh(ArenaPtr<Model> model) {
+    m_MeshTable.push_back(std::move(model));
+    return static_cast<MeshHandle>(m_MeshTable.size() - 1);
+}
+
+MaterialHandle ObjectStorage::addMaterial(const std::shared_ptr<Material>& material) {
+    if (!material) return DEFAULT_MATERIAL;
+
+    auto it = m_MaterialLookup.find(material.get());
+    if (it != m_MaterialLookup.end()) {
+        return it->second;
+    }
+
+    MaterialHandle handle = static_cast<MaterialHandle>(m_MaterialTable.size());
+    m_MaterialTable.push_back(material);
+    m_MaterialLookup[material.get()] = handle;
+    return handle;
+}
+
+void ObjectStorage::create(unsigned int id, MeshHandle mesh) {
+    if (id >= m_SparseIndex.size()) {
+        m_SparseIndex.resize(id + 1, INVALID_INDEX);
+    }
+    m_SparseIndex[id] = static_cast<uint32_t>(m_IDs.size());
+
+    m_IDs.push_back(id);
+    m_Transforms.emplace_back();
+    m_WorldMatrices.push_back(glm::mat4(1.0f));
+    m_PreviousMatrices.push_back(glm::mat4(1.0f));
+    m_NormalMatrices.push_back(glm::mat3(1.0f));
+    m_PreviousNormalMatrices.push_back(glm::mat3(1.0f));
+    m_Poses.push_back(ObjectPose());
+    m_PreviousPoses.push_back(ObjectPose());
+    m_WorldBounds.push_back(m_MeshTable[mesh]->getBounds());
+    m_Meshes.push_back(mesh);
+    m_Materials.push_back(DEFAULT_MATERIAL);
+    m_Flags.push_back(OBJECT_NEW);
+    m_Changed = true;
+}
+
+void ObjectStorage::destroy(unsigned int id) {
+    uint32_t index = indexOf(id);
+    if (index == INVALID_INDEX) return;
+
+    size_t last = m_IDs.size() - 1;
+    if (index != last) {
+        m_IDs[index] = m_IDs[last];
+        m_Transforms[index] = std::move(m_Transforms[last]);
+        m_WorldMatrices[index] = m_WorldMatrices[last];
+        m_PreviousMatrices[index] = m_PreviousMatrices[last];
+        m_NormalMatrices[index] = m_NormalMatrices[last];
+        m_PreviousNormalMatrices[index] = m_PreviousNormalMatrices[last];
+        m_Poses[index] = m_Poses[last];
+        m_PreviousPoses[index] = m_PreviousPoses[last];
+        m_WorldBounds[index] = m_WorldBounds[last];
+        m_Meshes[index] = m_Meshes[last];
+        m_Materials[index] = m_Materials[last];
+        m_Flags[index] = m_Flags[last];
+        m_SparseIndex[m_IDs[index]] = index;
+    }
+
+    m_IDs.pop_back();
+    m_Transforms.pop_back();
+    m_WorldMatrices.pop_back();
+    m_PreviousMatrices.pop_back();
+    m_NormalMatrices.pop_back();
+    m_PreviousNormalMatrices.pop_back();
+    m_Poses.pop_back();
+    m_PreviousPoses.pop_back();
+    m_WorldBounds.pop_back();
+    m_Meshes.pop_back();
+    m_Materials.pop_back();
+    m_Flags.pop_back();
+    m_SparseIndex[id] = INVALID_INDEX;
+    m_Changed = true;
+}
+
+void ObjectStorage::clear() {
+    m_IDs.clear();
+    m_Transforms.clear();
+    m_WorldMatrices.clear();
+    m_PreviousMatrices.clear();
+    m_NormalMatrices.clear();
+    m_PreviousNormalMatrices.clear();
+    m_Poses.clear();
+    m_PreviousPoses.clear();
+    m_WorldBounds.clear();
+    m_Meshes.clear();
+    m_Materials.clear();
+    m_Flags.clear();
+    m_SparseIndex.clear();
+    m_Changed = true;
+    m_Moving = false;
+
+    m_MeshTable.clear();
+    m_MaterialTable.clear();
+    m_MaterialLookup.clear();
+
+    // Handle 0 je vychozi material, stejne jako mel drive kazdy novy DrawableObject
+    m_MaterialTable.push_back(std::make_shared<Material>());
+}
+
+void ObjectStorage::storePreviousMatrices() {
+    std::copy(m_WorldMatrices.begin(), m_WorldMatrices.end(), m_PreviousMatrices.begin());
+    std::copy(m_NormalMatrices.begin(), m_NormalMatrices.end(), m_PreviousNormalMatrices.begin());
+    std::copy(m_Poses.begin(), m_Poses.end(), m_PreviousPoses.begin());
+}
+
+void ObjectStorage::updateWorldMatrices() {
+    const size_t count = m_IDs.size();
+    bool moving = false;
+    for (size_t i = 0; i < count; ++i) {
+        computeWorld(i);
+        const bool moved = m_WorldMatrices[i] != m_PreviousMatrices[i];
+        m_Flags[i] = moved ? (m_Flags[i] | OBJECT_MOVED) : (m_Flags[i] & ~OBJECT_MOVED);
+        moving = moving || moved;
+    }
+    m_Moving = moving;
+}
+
+void ObjectStorage::updateNewObjects() {
+    const size_t count = m_IDs.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (m_Flags[i] & OBJECT_NEW) {
+            computeWorld(i);
+        }
+    }
+}
+
+glm::mat3 ObjectStorage::computeNormalMatrix(const glm::mat4& model) {
+    glm::mat3 linear(model);
+    const float epsilon = 1e-4f;
+
+    float lengthX = glm::length(linear[0]);
+    float lengthY = glm::length(linear[1]);
+    float lengthZ = glm::length(linear[2]);
+
+    // Rotace + uniformni meritko: sloupce stejne dlouhe a navzajem kolme
+    bool uniformScale = std::fabs(lengthX - lengthY) <= epsilon * lengthX
+        && std::fabs(lengthX - lengthZ) <= epsilon * lengthX
+        && std::fabs(glm::dot(linear[0], linear[1])) <= epsilon * lengthX * lengthY
+        && std::fabs(glm::dot(linear[0], linear[2])) <= epsilon * lengthX * lengthZ
+        && std::fabs(glm::dot(linear[1], linear[2])) <= epsilon * lengthY * lengthZ;
+
+    if (uniformScale && lengthX > 0.0f) {
+        return linear * (1.0f / lengthX);
+    }
+    return glm::transpose(glm::inverse(linear));
+}
+
+ObjectPose ObjectStorage::decomposePose(const glm::mat4& model) {
+    ObjectPose pose;
+    if (model[0][3] != 0.0f || model[1][3] != 0.0f || model[2][3] != 0.0f || model[3][3] != 1.0f) {
+        return pose;
+    }
+
+    glm::mat3 linear(model);
+    glm::vec3 scale(glm::length(linear[0]), glm::length(linear[1]), glm::length(linear[2]));
+    if (scale.x <= 0.0f || scale.y <= 0.0f || scale.z <= 0.0f) return pose;
+
+    glm::mat3 rotation(linear[0] / scale.x, linear[1] / scale.y, linear[2] / scale.z);
+    const float epsilon = 1e-4f;
+    if (std::fabs(glm::dot(rotation[0], rotation[1])) > epsilon
+        || std::fabs(glm::dot(rotation[0], rotation[2])) > epsilon
+        || std::fabs(glm::dot(rotation[1], rotation[2])) > epsilon) {
+        return pose;
+    }
+    // Zrcadleni: zaporne meritko v ose x, at je rotace cista
+    if (glm::determinant(rotation) < 0.0f) {
+        scale.x = -scale.x;
+        rotation[0] = -rotation[0];
+    }
+
+    pose.translation = glm::vec3(model[3]);
+    pose.rotation = glm::quat_cast(rotation);
+    pose.scale = scale;
+    return pose;
+}
+
+bool ObjectStorage::interpolatePose(size_t index, float alpha, ObjectPose& pose) const {
+    const ObjectPose& prev = m_PreviousPoses[index];
+    const ObjectPose& current = m_Poses[index];
+    if (!prev.isValid() || !current.isValid()) return false;
+
+    pose.translation = glm::mix(prev.translation, current.translation, alpha);
+    pose.rotation = glm::slerp(prev.rotation, current.rotation, alpha);
+    pose.scale = glm::mix(prev.scale, current.scale, alpha);
+    return true;
+}
+
+glm::mat4 ObjectStorage::getInterpolatedMatrix(size_t index, float alpha) const {
+    if (!(m_Flags[index] & OBJECT_MOVED)) return m_WorldMatrices[index];
+
+    ObjectPose pose;
+    if (!interpolatePose(index, alpha, pose)) {
+        const glm::mat4& prev = m_PreviousMatrices[index];
+        return prev + (m_WorldMatrices[index] - prev) * alpha;
+    }
+
+    glm::mat4 model = glm::mat4_cast(pose.rotation);
+    model[0] *= pose.scale.x;
+    model[1] *= pose.scale.y;
+    model[2] *= pose.scale.z;
+    model[3] = glm::vec4(pose.translation, 1.0f);
+    return model;
+}
+
+glm::mat3 ObjectStorage::getInterpolatedNormalMatrix(size_t index, float alpha) const {
+    if (!(m_Flags[index] & OBJECT_MOVED)) return m_NormalMatrices[index];
+
+    ObjectPose pose;
+    if (!interpolatePose(index, alpha, pose)) {
+        // Normala se ve fragment shaderu normalizuje, linearni interpolace staci
+        const glm::mat3& prev = m_PreviousNormalMatrices[index];
+        return prev + (m_NormalMatrices[index] - prev) * alpha;
+    }
+
+    // transpose(inverse(R * S)) = R * S^-1
+    glm::mat3 normal = glm::mat3_cast(pose.rotation);
+    normal[0] /= pose.scale.x;
+    normal[1] /= pose.scale.y;
+    normal[2] /= pose.scale.z;
+    return normal;
+}
+
+void ObjectStorage::computeWorld(size_t i) {
+    const glm::mat4 world = m_Transforms[i].getMatrix();
+    m_WorldMatrices[i] = world;
+    m_NormalMatrices[i] = computeNormalMatrix(world);
+    m_Poses[i] = decomposePose(world);
+
+    if (m_Flags[i] & OBJECT_NEW) {
+        m_PreviousMatrices[i] = world;
+        m_PreviousNormalMatrices[i] = m_NormalMatrices[i];
+        m_PreviousPoses[i] = m_Poses[i];
+        m_Flags[i] &= ~OBJECT_NEW;
+    }
+
+    const Bounds& local = m_MeshTable[m_Meshes[i]]->getBounds();
+    float scaleX = glm::length(glm::vec3(world[0]));
+    float scaleY = glm::length(glm::vec3(world[1]));
+    float scaleZ = glm::length(glm::vec3(world[2]));
+
+    Bounds& bounds = m_WorldBounds[i];
+    bounds.center = glm::vec3(world * glm::vec4(local.center, 1.0f));
+    bounds.radius = local.radius * std::max(scaleX, std::max(scaleY, scaleZ));
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <unordered_map>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "Model.h"
+#include "TransformationComposite.h"
+#include "SceneArena.h"
+
+struct Material;
+
+using MeshHandle = uint32_t;
+using MaterialHandle = uint32_t;
+
+enum ObjectFlags : uint8_t {
+    OBJECT_UNLIT = 1 << 0,
+    OBJECT_NEW = 1 << 1, // world matice jeste nebyla spocitana
+    OBJECT_MOVED = 1 << 2, // v poslednim kroku se pohnul, kresli se interpolace
+};
+
+// World matice rozlozena na posun, rotaci a meritko (T * R * S) pro interpolaci
+// mezi kroky. Matice, ktera tak rozlozit nejde (zkoseni, Matrix20), ma scale = 0.
+struct ObjectPose {
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale = glm::vec3(0.0f);
+
+    bool isValid() const { return scale.x != 0.0f; }
+};
+
+// Komponenty objektu sceny ulozene v souvislych polich (structure of arrays).
+// Objekt je adresovan svym ID, husty index se pri odebirani meni (swap-remove).
+class ObjectStorage {
+public:
+    static const uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+    static const MaterialHandle DEFAULT_MATERIAL = 0;
+
+    ObjectStorage();
+    ~ObjectStorage();
+
+    MeshHandle addMesh(ArenaPtr<Model> model);
+    MaterialHandle addMaterial(const std::shared_ptr<Material>& material);
+
+    void create(unsigned int id, MeshHandle mesh);
+    void destroy(unsigned int id);
+    void clear();
+
+    uint32_t indexOf(unsigned int id) const {
+        return id < m_SparseIndex.size() ? m_SparseIndex[id] : INVALID_INDEX;
+    }
+    size_t size() const { return m_IDs.size(); }
+
+    // Update system: prev <- world pred krokem, world <- transformace po kroku
+    void storePreviousMatrices();
+    void updateWorldMatrices();
+    // Objekty pridane mezi kroky (napr. kliknutim) dostanou matici hned pred vykreslenim
+    void updateNewObjects();
+
+    // On-demand kresleni: pridani, odebrani, material nebo priznak od posledniho dotazu
+    bool consumeChanged() {
+        bool changed = m_Changed;
+        m_Changed = false;
+        return changed;
+    }
+    // Posledni krok nekterym objektem pohnul; interpolace mezi kroky meni obraz
+    bool isMoving() const { return m_Moving; }
+
+    // Posun a meritko linearne, rotace slerp; po slozkach by se rotujici objekt
+    // mezi kroky zkosil a zmensil. Nepohnuty objekt vraci primo world matici.
+    glm::mat4 getInterpolatedMatrix(size_t index, float alpha) const;
+    glm::mat3 getInterpolatedNormalMatrix(size_t index, float alpha) const;
+
+    // transpose(inverse(mat3(model))), pri uniformnim meritku jen mat3(model) / s
+    static glm::mat3 computeNormalMatrix(const glm::mat4& model);
+    static ObjectPose decomposePose(const glm::mat4& model);
+
+    unsigned int getID(size_t index) const { return m_IDs[index]; }
+    // Reference do pole: plati jen do dalsiho create()/destroy()/clear()
+    TransformationComposite& getTransformation(size_t index) { return m_Transforms[index]; }
+    const glm::mat4& getWorldMatrix(size_t index) const { return m_WorldMatrices[index]; }
+    const glm::mat3& getNormalMatrix(size_t index) const { return m_NormalMatrices[index]; }
+    const Bounds& getWorldBounds(size_t index) const { return m_WorldBounds[index]; }
+    MeshHandle getMeshHandle(size_t index) const { return m_Meshes[index]; }
+    MaterialHandle getMaterialHandle(size_t index) const { return m_Materials[index]; }
+    uint8_t getFlags(size_t index) const { return m_Flags[index]; }
+
+    void setMaterial(size_t index, MaterialHandle material) {
+        m_Materials[index] = material;
+        m_Changed = true;
+    }
+    void setFlag(size_t index, uint8_t flag, bool value) {
+        m_Flags[index] = value ? (m_Flags[index] | flag) : (m_Flags[index] & ~flag);
+        m_Changed = true;
+    }
+
+    const Model& getMesh(MeshHandle mesh) const { return *m_MeshTable[mesh]; }
+    const Material& getMaterial(MaterialHandle material) const { return *m_MaterialTable[material]; }
+
+private:
+    void computeWorld(size_t index);
+    // false = nektera poza nejde rozlozit, interpoluje se po slozkach matice
+    bool interpolatePose(size_t index, float alpha, ObjectPose& pose) const;
+
+    // Husta pole, vsechna stejne dlouha
+    std::vector<unsigned int> m_IDs;
+    std::vector<TransformationComposite> m_Transforms;
+    std::vector<glm::mat4> m_WorldMatrices;
+    std::vector<glm::mat4> m_PreviousMatrices;
+    std::vector<glm::mat3> m_NormalMatrices;
+    std::vector<glm::mat3> m_PreviousNormalMatrices;
+    std::vector<ObjectPose> m_Poses;
+    std::vector<ObjectPose> m_PreviousPoses;
+    std::vector<Bounds> m_WorldBounds;
+    std::vector<MeshHandle> m_Meshes;
+    std::vector<MaterialHandle> m_Materials;
+    std::vector<uint8_t> m_Flags;
+
+    // ID -> husty index
+    std::vector<uint32_t> m_SparseIndex;
+
+    bool m_Changed = true;
+    bool m_Moving = false;
+
+    std::vector<ArenaPtr<Model>> m_MeshTable;
+    std::vector<std::shared_ptr<Material>> m_MaterialTable;
+    std::unordered_map<const Material*, MaterialHandle> m_MaterialLookup;
+};
@@ -0,0 +1,42 @@
+#include "OffscreenTarget.h"
+#include "RenderStats.h"
+#include <iostream>
+#include <stdexcept>
+
+OffscreenTarget::OffscreenTarget(int width, int height)
+    : m_Width(width), m_Height(height) {
+    glGenRenderbuffers(1, &m_ColorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_ColorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+    glGenRenderbuffers(1, &m_DepthStencilBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_DepthStencilBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    // RGBA8 + D24S8
+    RenderStats::get().addTextureMemory((int64_t)width * height * 8);
+
+    glGenFramebuffers(1, &m_FBO);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, m_DepthStencilBuffer);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "Offscreen target incomplete: 0x" << std::hex << status << std::dec << std::endl;
+        throw std::runtime_error("Offscreen framebuffer creation failed.");
+    }
+}
+
+OffscreenTarget::~OffscreenTarget() {
+    if (m_FBO != 0) glDeleteFramebuffers(1, &m_FBO);
+    if (m_ColorBuffer != 0) glDeleteRenderbuffers(1, &m_ColorBuffer);
+    if (m_DepthStencilBuffer != 0) glDeleteRenderbuffers(1, &m_DepthStencilBuffer);
+    RenderStats::get().addTextureMemory(-(int64_t)m_Width * m_Height * 8);
+}
+
+void OffscreenTarget::bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, m_FBO);
+    glViewport(0, 0, m_Width, m_Height);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <GL/glew.h>
+
+// Framebuffer misto okna (headless beh): RGBA8 barva + D24S8 hloubka a stencil
+// jako u vychoziho framebufferu, aby fungoval stencil picking i Z-prepass.
+class OffscreenTarget {
+public:
+    OffscreenTarget(int width, int height);
+    ~OffscreenTarget();
+
+    OffscreenTarget(const OffscreenTarget&) = delete;
+    OffscreenTarget& operator=(const OffscreenTarget&) = delete;
+
+    // Navaze FBO pro kresleni i cteni a nastavi viewport
+    void bind() const;
+
+    GLuint getFBO() const { return m_FBO; }
+    int getWidth() const { return m_Width; }
+    int getHeight() const { return m_Height; }
+
+private:
+    GLuint m_FBO = 0;
+    GLuint m_ColorBuffer = 0;
+    GLuint m_DepthStencilBuffer = 0;
+    int m_Width;
+    int m_Height;
+};
@@ -1,14 +1,37 @@
 #pragma once
-#include "LIght.h"
+#include <glm/glm.hpp>
+#include <cmath>
 
-class PointLight : public Light {
-public:
+// std140 rozlozeni: skalary vyplnuji ctvrtou slozku predchoziho vec3
+struct PointLight {
     glm::vec3 position;
     float constant;
+    glm::vec3 color;
     float linear;
     float quadratic;
+    float _pad[3];
 
     PointLight(const glm::vec3& pos, const glm::vec3& col, float con = 1.0f, float lin = 0.09f, float quad = 0.032f)
-        : Light(col), position(pos), constant(con), linear(lin), quadratic(quad) {
+        : position(pos), constant(con), color(col), linear(lin), quadratic(quad), _pad{ 0.0f, 0.0f, 0.0f } {
+    }
+
+    // Vzdalenost, kde utlum srazi nejsilnejsi slozku barvy pod threshold
+    // (c + l*d + q*d^2 = I / threshold); bez utlumu vraci maxDistance
+    float getInfluenceRadius(float threshold = 5.0f / 256.0f, float maxDistance = 1000.0f) const {
+        float intensity = std::fmax(color.r, std::fmax(color.g, color.b));
+        float target = intensity / threshold;
+        if (target <= constant) return 0.0f;
+
+        float radius;
+        if (quadratic > 0.0f) {
+            radius = (-linear + std::sqrt(linear * linear - 4.0f * quadratic * (constant - target))) / (2.0f * quadratic);
+        }
+        else if (linear > 0.0f) {
+            radius = (target - constant) / linear;
+        }
+        else {
+            return maxDistance;
+        }
+        return std::fmin(radius, maxDistance);
     }
 };
\ No newline at end of file
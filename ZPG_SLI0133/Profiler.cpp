@@ -0,0 +1,102 @@
+#include "Profiler.h"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+Profiler& Profiler::get() {
+    static Profiler instance;
+    return instance;
+}
+
+int64_t Profiler::now() {
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point start = Clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+}
+
+ProfileTrack& Profiler::addTrack() {
+    std::unique_ptr<ProfileTrack> track(new ProfileTrack());
+    track->events.reset(new ProfileEvent[EVENTS_PER_THREAD]);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    track->id = (uint32_t)m_Tracks.size() + 1;
+    m_Tracks.push_back(std::move(track));
+    return *m_Tracks.back();
+}
+
+ProfileTrack& Profiler::localTrack() {
+    thread_local ProfileTrack* track = nullptr;
+    if (!track) {
+        track = &addTrack();
+    }
+    return *track;
+}
+
+ProfileTrack& Profiler::createTrack(const char* name, const char* category) {
+    ProfileTrack& track = addTrack();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    track.name = name;
+    track.category = category;
+    return track;
+}
+
+void Profiler::record(const char* name, int64_t start, int64_t end) {
+    record(localTrack(), name, start, end);
+}
+
+void Profiler::record(ProfileTrack& track, const char* name, int64_t start, int64_t end) {
+    // Jediny zapisovatel: relaxed cteni vlastniho citace, release pro export
+    uint64_t index = track.written.load(std::memory_order_relaxed);
+    ProfileEvent& event = track.events[index % EVENTS_PER_THREAD];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    track.written.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const char* name) {
+    ProfileTrack& track = localTrack();
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    track.name = name;
+}
+
+static void writeJsonString(std::ostream& out, const char* text) {
+    out << '"';
+    for (const char* c = text; *c; ++c) {
+        if (*c == '"' || *c == '\\') out << '\\';
+        out << *c;
+    }
+    out << '"';
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) return false;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    out << "{\"traceEvents\":[\n";
+    out << std::fixed << std::setprecision(3);
+
+    bool first = true;
+    for (const std::unique_ptr<ProfileTrack>& track : m_Tracks) {
+        out << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track->id
+            << ",\"args\":{\"name\":";
+        writeJsonString(out, track->name.empty() ? ("thread " + std::to_string(track->id)).c_str() : track->name.c_str());
+        out << "}}";
+        first = false;
+
+        // Plny buffer: platne je jen poslednich EVENTS_PER_THREAD zon
+        uint64_t written = track->written.load(std::memory_order_acquire);
+        uint64_t begin = written > EVENTS_PER_THREAD ? written - EVENTS_PER_THREAD : 0;
+        for (uint64_t i = begin; i < written; ++i) {
+            const ProfileEvent& event = track->events[i % EVENTS_PER_THREAD];
+            out << ",\n{\"name\":";
+            writeJsonString(out, event.name);
+            // trace_event casy jsou v mikrosekundach
+            out << ",\"cat\":\"" << track->category << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << track->id
+                << ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}";
+        }
+    }
+    out << "\n]}\n";
+    return (bool)out;
+}
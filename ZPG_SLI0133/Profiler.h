@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// ZPG_PROFILE=0 (napr. /DZPG_PROFILE=0) vypne zony uplne, makra se preloze na nic
+#ifndef ZPG_PROFILE
+#define ZPG_PROFILE 1
+#endif
+
+// Jedna zona: nazev musi zit po celou dobu behu (retezcovy literal)
+struct ProfileEvent {
+    const char* name;
+    int64_t start; // ns od startu profileru
+    int64_t end;
+};
+
+// Stopa v trace: jedno vlakno nebo jiny zdroj casu (GPU). Zapisovat do ni smi
+// vzdy jen jedno vlakno.
+struct ProfileTrack {
+    uint32_t id = 0;
+    std::string name;
+    const char* category = "cpu";
+    std::unique_ptr<ProfileEvent[]> events;
+    std::atomic<uint64_t> written{ 0 };
+};
+
+// Scoped CPU profiler. Kazde vlakno zapisuje do vlastniho kruhoveho bufferu bez zamku;
+// zamek se bere jen pri prvni zone vlakna (registrace) a pri exportu.
+class Profiler {
+public:
+    static const size_t EVENTS_PER_THREAD = 1 << 16;
+
+    static Profiler& get();
+    static int64_t now();
+    static bool isEnabled() { return ZPG_PROFILE != 0; }
+
+    void record(const char* name, int64_t start, int64_t end);
+    void record(ProfileTrack& track, const char* name, int64_t start, int64_t end);
+    // Nazev vlakna v trace (jinak "thread N")
+    void setThreadName(const char* name);
+    // Stopa nezavisla na vlaknu (GpuProfiler); zije stejne dlouho jako profiler
+    ProfileTrack& createTrack(const char* name, const char* category);
+
+    // Chrome trace_event JSON (chrome://tracing, Perfetto). Bezpecne z vlakna,
+    // ktere jako jedine zapisuje zony; ostatnim vlaknum muze prepsat nejstarsi udalosti.
+    bool writeChromeTrace(const std::string& path) const;
+
+private:
+    Profiler() = default;
+    ProfileTrack& addTrack();
+    ProfileTrack& localTrack();
+
+    mutable std::mutex m_Mutex;
+    // Stopy preziji sva vlakna, aby sly exportovat i pozdeji
+    std::vector<std::unique_ptr<ProfileTrack>> m_Tracks;
+};
+
+class ProfileScope {
+public:
+    // enabled = false: zona se nezaznamena (per-draw zony zapinane za behu)
+    explicit ProfileScope(const char* name, bool enabled = true)
+        : m_Name(enabled ? name : nullptr), m_Start(enabled ? Profiler::now() : 0) {
+    }
+    ~ProfileScope() {
+        if (m_Name) Profiler::get().record(m_Name, m_Start, Profiler::now());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    int64_t m_Start;
+};
+
+#if ZPG_PROFILE
+#define ZPG_PROFILE_CONCAT_(a, b) a##b
+#define ZPG_PROFILE_CONCAT(a, b) ZPG_PROFILE_CONCAT_(a, b)
+#define ZPG_PROFILE_SCOPE(name) ProfileScope ZPG_PROFILE_CONCAT(zpgProfileScope, __LINE__)(name)
+#define ZPG_PROFILE_THREAD(name) Profiler::get().setThreadName(name)
+#else
+#define ZPG_PROFILE_SCOPE(name) ((void)0)
+#define ZPG_PROFILE_THREAD(name) ((void)0)
+#endif
@@ -0,0 +1,150 @@
+#include "ProgramBinaryCache.h"
+#include "RenderDevice.h"
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+static const char* CACHE_DIRECTORY = "shader_cache";
+static const uint32_t CACHE_MAGIC = 0x4250475Au; // "ZGPB"
+static const uint32_t CACHE_VERSION = 1;
+
+struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t format;
+    uint32_t length;
+};
+
+ProgramBinaryCache::Stats ProgramBinaryCache::s_Stats;
+
+static uint64_t fnv1a(uint64_t hash, const char* data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ull;
+    }
+    // Oddelovac, aby "ab"+"c" a "a"+"bc" davaly ruzny hash
+    hash ^= 0xFF;
+    hash *= 1099511628211ull;
+    return hash;
+}
+
+static uint64_t fnv1a(uint64_t hash, const GLubyte* text) {
+    const char* str = text ? reinterpret_cast<const char*>(text) : "";
+    return fnv1a(hash, str, strlen(str));
+}
+
+bool ProgramBinaryCache::isSupported() {
+    // Handly NullRenderDevice nejsou GL programy
+    if (RenderDevice::get().isNull()) return false;
+
+    static int supported = -1;
+    if (supported < 0) {
+        GLint formats = 0;
+        if (GLEW_ARB_get_program_binary || GLEW_VERSION_4_1) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        // Nektere ovladace rozsireni hlasi, ale nenabizi zadny format
+        supported = formats > 0 ? 1 : 0;
+    }
+    return supported == 1;
+}
+
+uint64_t ProgramBinaryCache::computeKey(const std::string& vertexSource, const std::string& fragmentSource) {
+    uint64_t hash = 14695981039346656037ull;
+    hash = fnv1a(hash, reinterpret_cast<const char*>(&CACHE_VERSION), sizeof(CACHE_VERSION));
+    hash = fnv1a(hash, vertexSource.data(), vertexSource.size());
+    hash = fnv1a(hash, fragmentSource.data(), fragmentSource.size());
+    hash = fnv1a(hash, glGetString(GL_VENDOR));
+    hash = fnv1a(hash, glGetString(GL_RENDERER));
+    hash = fnv1a(hash, glGetString(GL_VERSION));
+    return hash;
+}
+
+std::string ProgramBinaryCache::pathFor(uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return std::string(CACHE_DIRECTORY) + "/" + name;
+}
+
+bool ProgramBinaryCache::load(GLuint program, uint64_t key) {
+    if (!isSupported()) return false;
+
+    std::ifstream file(pathFor(key), std::ios::binary);
+    if (!file.is_open()) {
+        s_Stats.misses++;
+        return false;
+    }
+
+    CacheHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || header.magic != CACHE_MAGIC || header.version != CACHE_VERSION || header.length == 0) {
+        s_Stats.rejected++;
+        return false;
+    }
+
+    // Delka z hlavicky se overi proti zbytku souboru drive, nez se podle ni alokuje
+    const std::streamoff dataStart = file.tellg();
+    file.seekg(0, std::ios::end);
+    const std::streamoff remaining = file.tellg() - dataStart;
+    file.seekg(dataStart);
+    if (!file || (std::streamoff)header.length > remaining) {
+        s_Stats.rejected++;
+        return false;
+    }
+
+    std::vector<char> binary(header.length);
+    file.read(binary.data(), binary.size());
+    if (!file || file.gcount() != (std::streamsize)binary.size()) {
+        s_Stats.rejected++;
+        return false;
+    }
+
+    glProgramBinary(program, (GLenum)header.format, binary.data(), (GLsizei)binary.size());
+
+    GLint success = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        s_Stats.rejected++;
+        return false;
+    }
+
+    s_Stats.hits++;
+    return true;
+}
+
+void ProgramBinaryCache::store(GLuint program, uint64_t key) {
+    if (!isSupported()) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) return;
+
+#ifdef _WIN32
+    _mkdir(CACHE_DIRECTORY);
+#else
+    mkdir(CACHE_DIRECTORY, 0755);
+#endif
+
+    std::ofstream file(pathFor(key), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Unable to write program binary " << pathFor(key) << std::endl;
+        return;
+    }
+
+    CacheHeader header = { CACHE_MAGIC, CACHE_VERSION, (uint32_t)format, (uint32_t)written };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+
+// Diskova cache slinkovanych programu (ARB_get_program_binary).
+// Klic je hash zdrojaku vcetne defines + vendor/renderer/verze ovladace,
+// po aktualizaci ovladace se tak binarky samy zneplatni.
+class ProgramBinaryCache {
+public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t rejected = 0; // binarka nalezena, ale poskozena nebo ji ovladac odmitl
+    };
+
+    static bool isSupported();
+    static uint64_t computeKey(const std::string& vertexSource, const std::string& fragmentSource);
+
+    // true = program je slinkovany z cache
+    static bool load(GLuint program, uint64_t key);
+    static void store(GLuint program, uint64_t key);
+
+    static const Stats& getStats() { return s_Stats; }
+
+private:
+    static std::string pathFor(uint64_t key);
+
+    static Stats s_Stats;
+};
@@ -3,43 +3,224 @@
 #include "Application.h"
 #include "InputController.h"
 #include "Scene.h"
+#include "Camera.h"
+#include "FrameAllocator.h"
+#include "ShaderLibrary.h"
+#include "InputRecorder.h"
+#include "SampleCounter.h"
+#include "Profiler.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
+#include "DynamicResolution.h"
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 
 Render::Render(Application& app)
     : m_App(app) {
 }
 
+Render::~Render() {
+}
+
+double Render::now() {
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point start = Clock::now();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
 void Render::run() {
     GLFWwindow* window = m_App.getWindow();
     InputController* controller = m_App.getController();
+    InputRecorder* recorder = m_App.getRecorder();
+    const RunOptions& options = m_App.getOptions();
+    DynamicResolution* dynamicResolution = m_App.getDynamicResolution();
+    const bool replaying = recorder && recorder->isReplaying();
+
+    // Statistika se sbira jen pri omezenem behu, s logem nebo pri prehravani
+    const bool recordFrames = options.frames > 0 || options.duration > 0.0 || !options.frameLog.empty() || replaying;
+    // Merene behy kresli vzdy, vynechane snimky by zkreslily statistiku
+    const bool onDemand = options.onDemand && window && !recordFrames;
+    int redrawFrames = 0;
+    m_Statistics.clear();
+    if (options.frames > 0) m_Statistics.reserve(options.frames);
+    else if (replaying) m_Statistics.reserve(recorder->getFrameCount());
+    // Novy timer pro kazdy beh: nedobehle dotazy predchozi sceny se nezapocitaji.
+    // Dynamicke rozliseni ho potrebuje i bez statistiky.
+    m_GpuTimer.reset(recordFrames || dynamicResolution ? new SampleCounter(GL_TIME_ELAPSED) : nullptr);
+    uint64_t gpuResults = 0;
+    uint64_t gpuWarmupSamples = 0;
+    // Prvni snimky (preklad shaderu, prvni upload) do statistiky nepatri
+    int warmupFrames = options.warmupFrames;
+    GpuProfiler::get().resetStatistics();
 
-    float lastTime = 0.0f;
+    double previousTime = now();
+    const double startTime = previousTime;
+    double accumulator = 0.0;
 
     glClearStencil(0);
+    ZPG_PROFILE_THREAD("main");
 
-    while (!glfwWindowShouldClose(window)) {
-        float currentTime = (float)glfwGetTime();
-        float deltaTime = currentTime - lastTime;
-        lastTime = currentTime;
+    while (window ? !glfwWindowShouldClose(window) : true) {
+        if (options.frames > 0 && (int)m_Statistics.getFrameCount() >= options.frames) break;
+        if (options.duration > 0.0 && now() - startTime >= options.duration) break;
+        ZPG_PROFILE_SCOPE("Frame");
 
-        if (controller) {
-            controller->processPollingInput(deltaTime);
+        FrameAllocator::get().beginFrame();
+#if ZPG_PROFILE
+        GpuProfiler::get().beginFrame();
+#endif
+        // Dokonci programy, jejichz asynchronni preklad mezitim dobehl
+        ShaderLibrary::get().poll();
+
+        double currentTime = now();
+        double frameTime = currentTime - previousTime;
+        previousTime = currentTime;
+
+        // Po dlouhem zaseknuti (nacitani sceny, breakpoint) nedohanime celou dobu
+        if (frameTime > MAX_FRAME_TIME) {
+            frameTime = MAX_FRAME_TIME;
         }
 
-        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        // Simulace pri prehravani jede se zaznamenanymi casy, ne s namerenymi
+        if (replaying) {
+            if (!recorder->nextFrame(frameTime)) break;
+        }
+        else if (recorder) {
+            recorder->beginFrame(frameTime);
+        }
+
+        double phaseTimes[PHASE_COUNT] = {};
+        double phaseStart = now();
+        auto endPhase = [&phaseTimes, &phaseStart](FramePhase phase) {
+            double t = now();
+            phaseTimes[phase] = t - phaseStart;
+#if ZPG_PROFILE
+            // Faze jako zona profileru, se stejnou delkou jako ve statistice
+            int64_t end = Profiler::now();
+            Profiler::get().record(FrameStatistics::getPhaseName(phase), end - (int64_t)((t - phaseStart) * 1e9), end);
+#endif
+            phaseStart = t;
+        };
+
+        if (controller) {
+            controller->processPollingInput(static_cast<float>(frameTime));
+        }
+        // Zmeny kamery ze vsech udalosti od minuleho snimku najednou; update (baterka)
+        // i render uz vidi nove matice
+        if (m_App.getActiveScene()) m_App.getActiveScene()->getCamera().flush();
+        endPhase(PHASE_INPUT);
 
         Scene* scene = m_App.getActiveScene();
         int currentSceneIndex = m_App.getCurrentSceneIndex();
 
+        float alpha = 1.0f;
+        if (scene) {
+            accumulator += frameTime;
+
+            int steps = 0;
+            while (accumulator >= FIXED_TIMESTEP && steps < MAX_STEPS_PER_FRAME) {
+                scene->update(static_cast<float>(FIXED_TIMESTEP), currentSceneIndex);
+                accumulator -= FIXED_TIMESTEP;
+                ++steps;
+            }
+
+            // Dohaneni je omezene; zbytek se zahodi, jinak by se zpozdeni nabalovalo.
+            if (accumulator >= FIXED_TIMESTEP) {
+                accumulator = std::fmod(accumulator, FIXED_TIMESTEP);
+            }
+
+            alpha = static_cast<float>(accumulator / FIXED_TIMESTEP);
+        }
+        endPhase(PHASE_UPDATE);
+
+        if (onDemand) {
+            bool changed = m_App.consumeRedrawRequest();
+            if (scene && scene->consumeChanges()) changed = true;
+            // Objekty s neprelozenym shaderem se zatim nekresli
+            if (ShaderLibrary::get().getPendingCount() > 0) changed = true;
+            if (changed) redrawFrames = REDRAW_FRAMES;
+
+            if (redrawFrames == 0) {
+                // Nic se nezmenilo: misto kresleni se ceka na vstup nebo udalost okna
+#if ZPG_PROFILE
+                GpuProfiler::get().endFrame();
+#endif
+                glfwWaitEventsTimeout(IDLE_TIMEOUT);
+                continue;
+            }
+            --redrawFrames;
+        }
+
+        if (dynamicResolution) dynamicResolution->begin();
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+        // Behem zahrivani se GPU meri jen pro dynamicke rozliseni; tyto vysledky
+        // prijdou o par snimku pozdeji a do statistiky se nezapocitaji
+        const bool measureGpu = dynamicResolution || (recordFrames && warmupFrames == 0);
         if (scene) {
-            scene->update(deltaTime, currentSceneIndex);
-            scene->render();
+            if (dynamicResolution) {
+                scene->setOutputSize(dynamicResolution->getOutputWidth(), dynamicResolution->getOutputHeight());
+            }
+            if (measureGpu) m_GpuTimer->begin();
+            scene->render(alpha);
+            if (measureGpu) m_GpuTimer->end();
+            if (measureGpu && warmupFrames > 0) ++gpuWarmupSamples;
+        }
+        if (dynamicResolution) dynamicResolution->end();
+        endPhase(PHASE_RENDER);
+
+        if (window) {
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+        else {
+            // Bez swapu by CPU utikalo GPU napred; cas snimku ma zahrnout i GPU praci
+            glFinish();
         }
+        if (replaying && controller) {
+            controller->dispatchReplayEvents();
+        }
+        endPhase(PHASE_PRESENT);
+#if ZPG_PROFILE
+        GpuProfiler::get().endFrame();
+#endif
+        RenderStats::get().endFrame(frameTime);
+
+        if (recordFrames && warmupFrames > 0) {
+            if (--warmupFrames == 0) GpuProfiler::get().resetStatistics();
+        }
+        else if (recordFrames) {
+            m_Statistics.addFrame(now() - currentTime, phaseTimes);
+        }
+
+        // Vysledek GPU dotazu je o par snimku starsi; bere se jen novy
+        if (m_GpuTimer && m_GpuTimer->getResultCount() != gpuResults) {
+            gpuResults = m_GpuTimer->getResultCount();
+            const double gpuTime = m_GpuTimer->getLastResult() * 1e-9;
+            if (dynamicResolution) dynamicResolution->addGpuTime(gpuTime);
+            if (recordFrames && warmupFrames == 0 && gpuResults > gpuWarmupSamples) {
+                m_Statistics.addGpuTime(gpuTime);
+            }
+        }
+    }
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+    if (recorder && recorder->isRecording()) {
+        recorder->save();
+    }
+
+    if (recordFrames) {
+        m_Statistics.print(std::cout);
+        GpuProfiler::get().print(std::cout);
+        if (!options.frameLog.empty()) {
+            if (m_Statistics.writeCsv(options.frameLog)) {
+                std::cout << "Frame log: " << options.frameLog << std::endl;
+            }
+            else {
+                std::cerr << "Cannot write frame log: " << options.frameLog << std::endl;
+            }
+        }
     }
 }
\ No newline at end of file
@@ -1,12 +1,34 @@
 #pragma once
+#include <memory>
+#include "FrameStatistics.h"
 
 class Application;
+class SampleCounter;
 
 class Render {
 private:
     Application& m_App;
+    FrameStatistics m_Statistics;
+    // GL_TIME_ELAPSED kolem scene->render
+    std::unique_ptr<SampleCounter> m_GpuTimer;
+
+    // Simulace bezi v pevnych krocich, kresleni interpoluje mezi poslednimi dvema.
+    static constexpr double FIXED_TIMESTEP = 1.0 / 60.0;
+    static constexpr int MAX_STEPS_PER_FRAME = 5;
+    static constexpr double MAX_FRAME_TIME = 0.25;
+
+    // On-demand: po zmene se kresli tolik snimku, aby ji mely vsechny buffery swap
+    // chainu (picking cte zadni buffer); bez zmeny se ceka na udalost nejvys IDLE_TIMEOUT
+    static const int REDRAW_FRAMES = 2;
+    static constexpr double IDLE_TIMEOUT = 0.1;
+
+    static double now();
 
 public:
     Render(Application& app);
+    ~Render();
     void run();
+
+    // Statistika posledniho run() (bez zahrivacich snimku)
+    const FrameStatistics& getStatistics() const { return m_Statistics; }
 };
\ No newline at end of file
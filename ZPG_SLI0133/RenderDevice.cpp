@@ -0,0 +1,13 @@
+#include "RenderDevice.h"
+#include "GLRenderDevice.h"
+
+static GLRenderDevice s_GLDevice;
+static RenderDevice* s_Device = &s_GLDevice;
+
+RenderDevice& RenderDevice::get() {
+    return *s_Device;
+}
+
+void RenderDevice::set(RenderDevice* device) {
+    s_Device = device ? device : &s_GLDevice;
+}
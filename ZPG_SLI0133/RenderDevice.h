@@ -0,0 +1,99 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstddef>
+#include <string>
+#include <glm/glm.hpp>
+
+// Tenka vrstva nad GL pro Model, Shader, ShaderProgram, TextureLoader, LightStorage,
+// SampleCounter a Scene. Metody odpovidaji primo volanim GL, ktera tyto tridy pouzivaji.
+// GLRenderDevice vola GL, NullRenderDevice nic nekresli, jen zaznamenava prikazy
+// a pocita zmeny stavu (testy a mereni CPU casti bez GPU a bez GL kontextu).
+// DeferredRenderer, OffscreenTarget, GpuProfiler a okno volaji GL dal primo.
+class RenderDevice {
+public:
+    // Aktualni zarizeni; vychozi je GLRenderDevice
+    static RenderDevice& get();
+    // nullptr vrati GLRenderDevice. Prepinat jen bez zivych GL objektu (pred nactenim sceny)
+    static void set(RenderDevice* device);
+
+    virtual ~RenderDevice() = default;
+
+    // true = nevola GL (ProgramBinaryCache a podobne se vypnou)
+    virtual bool isNull() const = 0;
+
+    // Buffery
+    virtual GLuint genBuffer() = 0;
+    virtual void deleteBuffer(GLuint buffer) = 0;
+    virtual void bindBuffer(GLenum target, GLuint buffer) = 0;
+    virtual void bindBufferBase(GLenum target, GLuint index, GLuint buffer) = 0;
+    virtual void bufferData(GLenum target, size_t size, const void* data, GLenum usage) = 0;
+    virtual void bufferSubData(GLenum target, size_t offset, size_t size, const void* data) = 0;
+
+    // Vertex array
+    virtual GLuint genVertexArray() = 0;
+    virtual void deleteVertexArray(GLuint vao) = 0;
+    virtual void bindVertexArray(GLuint vao) = 0;
+    virtual void enableVertexAttribArray(GLuint index) = 0;
+    virtual void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, size_t offset) = 0;
+
+    // Textury
+    virtual GLuint genTexture() = 0;
+    virtual void deleteTexture(GLuint texture) = 0;
+    virtual void activeTexture(GLenum unit) = 0;
+    virtual void bindTexture(GLenum target, GLuint texture) = 0;
+    virtual void texImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height,
+        GLenum format, GLenum type, const void* data) = 0;
+    virtual void texParameteri(GLenum target, GLenum name, GLint value) = 0;
+    virtual void generateMipmap(GLenum target) = 0;
+
+    // Shadery a programy
+    virtual GLuint createShader(GLenum type) = 0;
+    virtual void deleteShader(GLuint shader) = 0;
+    virtual void shaderSource(GLuint shader, const char* source) = 0;
+    virtual void compileShader(GLuint shader) = 0;
+    virtual GLint getShaderi(GLuint shader, GLenum name) = 0;
+    virtual std::string getShaderInfoLog(GLuint shader) = 0;
+
+    virtual GLuint createProgram() = 0;
+    virtual void deleteProgram(GLuint program) = 0;
+    virtual void attachShader(GLuint program, GLuint shader) = 0;
+    virtual void programParameteri(GLuint program, GLenum name, GLint value) = 0;
+    virtual void linkProgram(GLuint program) = 0;
+    virtual GLint getProgrami(GLuint program, GLenum name) = 0;
+    virtual std::string getProgramInfoLog(GLuint program) = 0;
+    virtual GLint getUniformLocation(GLuint program, const char* name) = 0;
+    virtual GLuint getUniformBlockIndex(GLuint program, const char* name) = 0;
+    virtual void uniformBlockBinding(GLuint program, GLuint blockIndex, GLuint binding) = 0;
+    virtual void useProgram(GLuint program) = 0;
+
+    // Uniformy aktualniho programu
+    virtual void uniform(GLint location, int value) = 0;
+    virtual void uniform(GLint location, float value) = 0;
+    virtual void uniform(GLint location, const glm::vec3& value) = 0;
+    virtual void uniform(GLint location, const glm::vec4& value) = 0;
+    virtual void uniform(GLint location, const glm::ivec4& value) = 0;
+    virtual void uniform(GLint location, const glm::mat3& value) = 0;
+    virtual void uniform(GLint location, const glm::mat4& value) = 0;
+
+    // Fixni stav
+    virtual void enable(GLenum capability) = 0;
+    virtual void disable(GLenum capability) = 0;
+    virtual void depthFunc(GLenum func) = 0;
+    virtual void depthMask(GLboolean enabled) = 0;
+    virtual void colorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) = 0;
+    virtual void stencilFunc(GLenum func, GLint ref, GLuint mask) = 0;
+    virtual void stencilOp(GLenum stencilFail, GLenum depthFail, GLenum pass) = 0;
+    virtual void stencilMask(GLuint mask) = 0;
+    // x, y, sirka, vyska
+    virtual void getViewport(GLint viewport[4]) = 0;
+
+    virtual void drawArrays(GLenum mode, GLint first, GLsizei count) = 0;
+
+    // Dotazy (GL_SAMPLES_PASSED, GL_TIME_ELAPSED)
+    virtual void genQueries(GLsizei count, GLuint* queries) = 0;
+    virtual void deleteQueries(GLsizei count, const GLuint* queries) = 0;
+    virtual void beginQuery(GLenum target, GLuint query) = 0;
+    virtual void endQuery(GLenum target) = 0;
+    virtual bool isQueryResultAvailable(GLuint query) = 0;
+    virtual GLuint64 getQueryResult(GLuint query) = 0;
+};
@@ -0,0 +1,92 @@
+#include "RenderStats.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+RenderStats& RenderStats::get() {
+    static RenderStats instance;
+    return instance;
+}
+
+uint64_t RenderStats::trianglesFor(GLenum mode, int vertexCount) {
+    if (vertexCount < 3) return 0;
+    switch (mode) {
+    case GL_TRIANGLES: return (uint64_t)(vertexCount / 3);
+    case GL_TRIANGLE_STRIP:
+    case GL_TRIANGLE_FAN: return (uint64_t)(vertexCount - 2);
+    default: return 0;
+    }
+}
+
+bool RenderStats::openMetricsFile(const std::string& path) {
+    m_Metrics.open(path);
+    if (!m_Metrics) return false;
+
+    m_Metrics << "time_s,frames,draws_avg,draws_max,triangles_avg,triangles_max,vertices_avg,"
+        << "program_binds_avg,vao_binds_avg,texture_binds_avg,uniforms_avg,upload_bytes_avg,upload_bytes_max,"
+        << "buffer_bytes,texture_bytes\n";
+    if (m_ReportInterval <= 0.0) m_ReportInterval = 1.0;
+    return true;
+}
+
+void RenderStats::endFrame(double frameTime) {
+    m_LastFrame = m_Frame;
+    m_Frame = RenderCounters();
+    if (m_ReportInterval <= 0.0) return;
+
+    m_WindowTotal.drawCalls += m_LastFrame.drawCalls;
+    m_WindowTotal.triangles += m_LastFrame.triangles;
+    m_WindowTotal.vertices += m_LastFrame.vertices;
+    m_WindowTotal.programBinds += m_LastFrame.programBinds;
+    m_WindowTotal.vaoBinds += m_LastFrame.vaoBinds;
+    m_WindowTotal.textureBinds += m_LastFrame.textureBinds;
+    m_WindowTotal.uniformCalls += m_LastFrame.uniformCalls;
+    m_WindowTotal.uploadBytes += m_LastFrame.uploadBytes;
+
+    m_WindowMax.drawCalls = std::max(m_WindowMax.drawCalls, m_LastFrame.drawCalls);
+    m_WindowMax.triangles = std::max(m_WindowMax.triangles, m_LastFrame.triangles);
+    m_WindowMax.uploadBytes = std::max(m_WindowMax.uploadBytes, m_LastFrame.uploadBytes);
+
+    m_WindowFrames++;
+    m_WindowTime += frameTime;
+    m_TotalTime += frameTime;
+    if (m_WindowTime >= m_ReportInterval) {
+        report();
+        m_WindowTotal = RenderCounters();
+        m_WindowMax = RenderCounters();
+        m_WindowFrames = 0;
+        m_WindowTime = 0.0;
+    }
+}
+
+void RenderStats::report() {
+    if (m_WindowFrames == 0) return;
+    const double frames = (double)m_WindowFrames;
+    auto avg = [frames](uint64_t total) { return (uint64_t)((double)total / frames + 0.5); };
+
+    if (m_Metrics.is_open()) {
+        m_Metrics << std::fixed << std::setprecision(3) << m_TotalTime << std::defaultfloat
+            << "," << m_WindowFrames
+            << "," << avg(m_WindowTotal.drawCalls) << "," << m_WindowMax.drawCalls
+            << "," << avg(m_WindowTotal.triangles) << "," << m_WindowMax.triangles
+            << "," << avg(m_WindowTotal.vertices)
+            << "," << avg(m_WindowTotal.programBinds) << "," << avg(m_WindowTotal.vaoBinds)
+            << "," << avg(m_WindowTotal.textureBinds) << "," << avg(m_WindowTotal.uniformCalls)
+            << "," << avg(m_WindowTotal.uploadBytes) << "," << m_WindowMax.uploadBytes
+            << "," << m_BufferMemory << "," << m_TextureMemory << "\n";
+        m_Metrics.flush();
+        return;
+    }
+
+    std::cout << "Render stats (" << m_WindowFrames << " frames, avg/max per frame): "
+        << "draws " << avg(m_WindowTotal.drawCalls) << "/" << m_WindowMax.drawCalls
+        << ", tris " << avg(m_WindowTotal.triangles) << "/" << m_WindowMax.triangles
+        << ", verts " << avg(m_WindowTotal.vertices)
+        << ", programs " << avg(m_WindowTotal.programBinds)
+        << ", VAOs " << avg(m_WindowTotal.vaoBinds)
+        << ", textures " << avg(m_WindowTotal.textureBinds)
+        << ", uniforms " << avg(m_WindowTotal.uniformCalls)
+        << ", upload " << avg(m_WindowTotal.uploadBytes) / 1024 << " KB"
+        << " | GPU memory: buffers " << m_BufferMemory / 1024 << " KB, textures "
+        << m_TextureMemory / 1024 << " KB" << std::endl;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+// GL prace odeslana za jeden snimek
+struct RenderCounters {
+    uint64_t drawCalls = 0;
+    uint64_t triangles = 0;
+    uint64_t vertices = 0;
+    uint64_t programBinds = 0;
+    uint64_t vaoBinds = 0;
+    uint64_t textureBinds = 0;
+    uint64_t uniformCalls = 0;
+    uint64_t uploadBytes = 0; // glBufferData/SubData a glTexImage
+};
+
+// Pocitadla za snimek a odhad zive GPU pameti (buffery, textury, renderbuffery).
+// Pocita se primo v mistech, kde kod vola GL (Model::draw, ShaderProgram::set*, ...).
+class RenderStats {
+public:
+    static RenderStats& get();
+
+    void countDraw(GLenum mode, int vertexCount) {
+        m_Frame.drawCalls++;
+        m_Frame.vertices += (uint64_t)vertexCount;
+        m_Frame.triangles += trianglesFor(mode, vertexCount);
+    }
+    void countProgramBind() { m_Frame.programBinds++; }
+    void countVaoBind() { m_Frame.vaoBinds++; }
+    void countTextureBind(int count = 1) { m_Frame.textureBinds += (uint64_t)count; }
+    void countUniform() { m_Frame.uniformCalls++; }
+    void countUpload(size_t bytes) { m_Frame.uploadBytes += bytes; }
+
+    // Zaporne pri uvolneni
+    void addBufferMemory(int64_t bytes) { m_BufferMemory += bytes; }
+    void addTextureMemory(int64_t bytes) { m_TextureMemory += bytes; }
+    int64_t getBufferMemory() const { return m_BufferMemory; }
+    int64_t getTextureMemory() const { return m_TextureMemory; }
+
+    // Render::run, na konci snimku
+    void endFrame(double frameTime);
+
+    const RenderCounters& getCurrentFrame() const { return m_Frame; }
+    const RenderCounters& getLastFrame() const { return m_LastFrame; }
+
+    // Prumer a maximum na snimek za poslednich N sekund na stdout; 0 = vypnuto
+    void setReportInterval(double seconds) { m_ReportInterval = seconds; }
+    // Stejny souhrn jako radek CSV; bez intervalu se zapisuje po sekunde
+    bool openMetricsFile(const std::string& path);
+
+private:
+    RenderStats() = default;
+
+    static uint64_t trianglesFor(GLenum mode, int vertexCount);
+    void report();
+
+    RenderCounters m_Frame;
+    RenderCounters m_LastFrame;
+
+    RenderCounters m_WindowTotal;
+    RenderCounters m_WindowMax;
+    int m_WindowFrames = 0;
+    double m_WindowTime = 0.0;
+    double m_TotalTime = 0.0;
+
+    double m_ReportInterval = 0.0;
+    std::ofstream m_Metrics;
+
+    int64_t m_BufferMemory = 0;
+    int64_t m_TextureMemory = 0;
+};
@@ -0,0 +1,47 @@
+#include "SampleCounter.h"
+#include "RenderDevice.h"
+
+SampleCounter::SampleCounter(GLenum target)
+    : m_Target(target) {
+    RenderDevice::get().genQueries(QUERY_COUNT, m_Queries);
+    for (int i = 0; i < QUERY_COUNT; ++i) {
+        m_Pending[i] = false;
+    }
+}
+
+SampleCounter::~SampleCounter() {
+    RenderDevice::get().deleteQueries(QUERY_COUNT, m_Queries);
+}
+
+void SampleCounter::begin() {
+    collect();
+
+    // Vsechny dotazy jeste bezi: tento snimek se nemeri, radsi nez cekat
+    if (m_Pending[m_Current]) return;
+
+    RenderDevice::get().beginQuery(m_Target, m_Queries[m_Current]);
+    m_Active = true;
+}
+
+void SampleCounter::end() {
+    if (!m_Active) return;
+
+    RenderDevice::get().endQuery(m_Target);
+    m_Pending[m_Current] = true;
+    m_Current = (m_Current + 1) % QUERY_COUNT;
+    m_Active = false;
+}
+
+void SampleCounter::collect() {
+    // Od nejstarsiho; vysledky dotazu se dokoncuji v poradi zadani
+    for (int n = 0; n < QUERY_COUNT; ++n) {
+        int i = (m_Current + n) % QUERY_COUNT;
+        if (!m_Pending[i]) continue;
+
+        if (!RenderDevice::get().isQueryResultAvailable(m_Queries[i])) break;
+
+        m_LastResult = RenderDevice::get().getQueryResult(m_Queries[i]);
+        m_ResultCount++;
+        m_Pending[i] = false;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <GL/glew.h>
+#include <cstdint>
+
+// GL_SAMPLES_PASSED (nebo jiny) dotaz kolem casti snimku. Vysledek se cte az o par
+// snimku pozdeji (az je k dispozici), aby se necekalo na GPU.
+// S GL_TIME_ELAPSED meri cas GPU v nanosekundach.
+class SampleCounter {
+public:
+    // Dotazy v letu; vysledek muze byt nejvyse o tolik snimku starsi
+    static const int QUERY_COUNT = 3;
+
+    explicit SampleCounter(GLenum target = GL_SAMPLES_PASSED);
+    ~SampleCounter();
+
+    SampleCounter(const SampleCounter&) = delete;
+    SampleCounter& operator=(const SampleCounter&) = delete;
+
+    void begin();
+    void end();
+
+    // Posledni precteny vysledek (snimek stary QUERY_COUNT - 1 a mene)
+    uint64_t getLastResult() const { return m_LastResult; }
+    // Pocet dosud prectenych vysledku; zmena = prisel novy vysledek
+    uint64_t getResultCount() const { return m_ResultCount; }
+
+private:
+    void collect();
+
+    GLenum m_Target;
+    GLuint m_Queries[QUERY_COUNT];
+    bool m_Pending[QUERY_COUNT];
+    int m_Current = 0;
+    bool m_Active = false;
+    uint64_t m_LastResult = 0;
+    uint64_t m_ResultCount = 0;
+};
@@ -5,12 +5,18 @@
 #include "TransformationComposite.h"
 #include "Camera.h"
 #include "Shader.h" 
-#include "Light.h"
 #include "TextureLoader.h" 
 #include "tree.h"
 #include "bushes.h"
 // #include "sphere.h" // Uz nepotrebujeme, pouzivame planet.obj
 #include "Material.h" 
+#include "FrameAllocator.h"
+#include "ShaderLibrary.h"
+#include "DeferredRenderer.h"
+#include "Profiler.h"
+#include "GpuProfiler.h"
+#include "RenderStats.h"
+#include "RenderDevice.h"
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 #include <cmath>
@@ -25,33 +31,33 @@ extern bool direction;
 
 Scene::Scene()
     : m_FireflyTime(0.0f),
-    m_AmbientLightColor(0.05f, 0.05f, 0.05f),
+    m_Flashlight(
+        glm::vec3(0, 0, 0),
+        glm::vec3(0, 0, -1),
+        glm::vec3(1.0f, 1.0f, 1.0f),
+        1.0f, 0.09f, 0.032f,
+        glm::cos(glm::radians(12.5f)),
+        glm::cos(glm::radians(15.5f))),
     m_FlashlightOn(false),
+    m_AmbientLightColor(0.05f, 0.05f, 0.05f),
     m_Score(0),
     m_SpawnTimer(0.0f),
     m_GameRunning(false),
     m_GameFinished(false),
     m_PlayerName("Hrac")
 {
-    m_Flashlight = std::make_unique<SpotLight>(
-        glm::vec3(0, 0, 0),
-        glm::vec3(0, 0, -1),
-        glm::vec3(1.0f, 1.0f, 1.0f),
-        1.0f, 0.09f, 0.032f,
-        glm::cos(glm::radians(12.5f)),
-        glm::cos(glm::radians(15.5f))
-    );
 }
 
-void Scene::InitSkybox()
+Scene::~Scene()
 {
-    auto vert = std::make_unique<Shader>(GL_VERTEX_SHADER, "skybox.vert");
-    auto frag = std::make_unique<Shader>(GL_FRAGMENT_SHADER, "skybox.frag");
-    skyboxShader = std::make_shared<ShaderProgram>(*vert, *frag);
+    ShaderLibrary::get().unbindCamera(camera.get());
+}
 
-    auto model = std::make_unique<Model>("assets/sky/skybox.obj");
+void Scene::InitSkybox()
+{
+    skyboxShader = ShaderLibrary::get().getProgram("skybox.vert", "skybox.frag");
 
-    skyboxObject = std::make_unique<DrawableObject>(std::move(model), skyboxShader);
+    skyboxModel = std::make_unique<Model>("assets/sky/skybox.obj");
 
     std::vector<std::string> faces =
     {
@@ -67,11 +73,6 @@ void Scene::InitSkybox()
 
 
 void Scene::createShaders(const std::string& vertexShaderFile, const std::string& fragmentShaderFile) {
-    Shader vs(GL_VERTEX_SHADER, vertexShaderFile.c_str());
-    Shader fs(GL_FRAGMENT_SHADER, fragmentShaderFile.c_str());
-
-    colorShaderProgram = std::make_shared<ShaderProgram>(vs, fs);
-
     int width = 1024, height = 768;
     camera = std::make_unique<Camera>(glm::vec3(0.0f, 30.0f, 40.0f));
 
@@ -82,12 +83,23 @@ void Scene::createShaders(const std::string& vertexShaderFile, const std::string
     camera->setFi(glm::radians(-90.0f));
     camera->setAlpha(glm::radians(-37.0f));
 
-    camera->attach(colorShaderProgram.get());
-    camera->updateMatrices();
+    // Sdilene programy z knihovny ted pozoruji kameru teto sceny
+    ShaderLibrary::get().bindCamera(camera.get());
+
+    // Varianty se prekladaji az v render() podle toho, co objekty a svetla sceny potrebuji
+    m_ShaderVariants = std::make_unique<ShaderVariantManager>(vertexShaderFile, fragmentShaderFile);
+    m_DepthPrepassShader = ShaderLibrary::get().getProgram("depth_prepass.vert", "depth_prepass.frag");
+    m_ShadedSamples = std::make_unique<SampleCounter>();
+    m_SkyboxSamples = std::make_unique<SampleCounter>();
+    camera->flush();
 }
 
-std::shared_ptr<Material> createTexturedMaterial(const std::string& texturePath, float shininess = 32.0f) {
-    auto mat = std::make_shared<Material>();
+std::shared_ptr<Material> Scene::createMaterial() {
+    return std::allocate_shared<Material>(ArenaAllocator<Material>(&m_Arena));
+}
+
+static std::shared_ptr<Material> createTexturedMaterial(Scene& scene, const std::string& texturePath, float shininess = 32.0f) {
+    auto mat = scene.createMaterial();
     mat->diffuse = glm::vec3(1.0f);
     mat->specular = glm::vec3(0.1f);
     mat->shininess = shininess;
@@ -100,163 +112,446 @@ void Scene::initSolarSystem() {
     const char* planetModelPath = "assets/planet.obj";
 
     // 1. Slunce
-    auto sunMat = createTexturedMaterial("assets/texture/2k_sun.jpg");
+    auto sunMat = createTexturedMaterial(*this, "assets/texture/2k_sun.jpg");
     sunMat->ambient = glm::vec3(1.0f); // Slunce zari
 
     m_Sun = addGameObject(planetModelPath);
-    m_Sun->setMaterial(sunMat);
-    m_Sun->setUnlit(true); // Neprijima stiny
+    m_Sun.setMaterial(sunMat);
+    m_Sun.setUnlit(true); // Neprijima stiny
 
     addPointLight(glm::vec3(0.0f), glm::vec3(1.5f, 1.5f, 1.4f), 1.0f, 0.02f, 0.005f);
 
     // 2. Merkur
     m_Mercury = addGameObject(planetModelPath);
-    m_Mercury->setMaterial(createTexturedMaterial("assets/texture/2k_mercury.jpg"));
+    m_Mercury.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_mercury.jpg"));
 
     // 3. Venuse
     m_Venus = addGameObject(planetModelPath);
-    m_Venus->setMaterial(createTexturedMaterial("assets/texture/2k_venus_surface.jpg"));
+    m_Venus.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_venus_surface.jpg"));
 
     // 4. Zeme
     m_Earth = addGameObject(planetModelPath);
-    m_Earth->setMaterial(createTexturedMaterial("assets/texture/2k_earth_daymap.jpg"));
+    m_Earth.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_earth_daymap.jpg"));
 
     // 5. Mesic
     m_Moon = addGameObject(planetModelPath);
-    m_Moon->setMaterial(createTexturedMaterial("assets/texture/moon.jpeg"));
+    m_Moon.setMaterial(createTexturedMaterial(*this, "assets/texture/moon.jpeg"));
 
     // 6. Mars
     m_Mars = addGameObject(planetModelPath);
-    m_Mars->setMaterial(createTexturedMaterial("assets/texture/2k_mars.jpg"));
+    m_Mars.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_mars.jpg"));
 
     // 7. Jupiter
     m_Jupiter = addGameObject(planetModelPath);
-    m_Jupiter->setMaterial(createTexturedMaterial("assets/texture/2k_jupiter.jpg"));
+    m_Jupiter.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_jupiter.jpg"));
 
     // 8. Saturn
     m_Saturn = addGameObject(planetModelPath);
-    m_Saturn->setMaterial(createTexturedMaterial("assets/texture/2k_saturn.jpg"));
+    m_Saturn.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_saturn.jpg"));
 
     // 9. Uran
     m_Uranus = addGameObject(planetModelPath);
-    m_Uranus->setMaterial(createTexturedMaterial("assets/texture/2k_uranus.jpg"));
+    m_Uranus.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_uranus.jpg"));
 
     // 10. Neptun
     m_Neptune = addGameObject(planetModelPath);
-    m_Neptune->setMaterial(createTexturedMaterial("assets/texture/2k_neptune.jpg"));
+    m_Neptune.setMaterial(createTexturedMaterial(*this, "assets/texture/2k_neptune.jpg"));
 }
 
-void Scene::addObject(const float* data, size_t size, int stride) {
-    std::unique_ptr<Model> m = std::make_unique<Model>(data, size, stride);
-    std::unique_ptr<DrawableObject> obj = std::make_unique<DrawableObject>(std::move(m), colorShaderProgram);
-
-    m_ObjectCounter++;
-    obj->setID(m_ObjectCounter);
-
-    objects.push_back(std::move(obj));
+MeshHandle Scene::getMesh(const float* data, size_t size, int stride) {
+    auto it = m_MeshesByData.find(data);
+    if (it != m_MeshesByData.end()) {
+        return it->second;
+    }
+    MeshHandle mesh = m_Objects.addMesh(makeArenaPtr<Model>(&m_Arena, data, size, stride));
+    m_MeshesByData[data] = mesh;
+    return mesh;
 }
 
-void Scene::addObject(const char* modelName) {
-    std::unique_ptr<Model> m = std::make_unique<Model>(modelName);
-    std::unique_ptr<DrawableObject> obj = std::make_unique<DrawableObject>(std::move(m), colorShaderProgram);
+MeshHandle Scene::getMesh(const char* modelName) {
+    auto it = m_MeshesByPath.find(modelName);
+    if (it != m_MeshesByPath.end()) {
+        return it->second;
+    }
+    MeshHandle mesh = m_Objects.addMesh(makeArenaPtr<Model>(&m_Arena, modelName));
+    m_MeshesByPath[modelName] = mesh;
+    return mesh;
+}
 
+DrawableObject Scene::createObject(MeshHandle mesh) {
     m_ObjectCounter++;
-    obj->setID(m_ObjectCounter);
-
-    objects.push_back(std::move(obj));
+    unsigned int id = static_cast<unsigned int>(m_ObjectCounter);
+    m_Objects.create(id, mesh);
+    return DrawableObject(m_Objects, id);
 }
 
-DrawableObject* Scene::addGameObject(const char* modelName) {
-    std::unique_ptr<Model> m = std::make_unique<Model>(modelName);
-    std::unique_ptr<DrawableObject> obj = std::make_unique<DrawableObject>(std::move(m), colorShaderProgram);
+void Scene::addObject(const float* data, size_t size, int stride) {
+    createObject(getMesh(data, size, stride));
+}
 
-    m_ObjectCounter++;
-    obj->setID(m_ObjectCounter);
+void Scene::addObject(const char* modelName) {
+    createObject(getMesh(modelName));
+}
 
-    DrawableObject* ptr = obj.get();
-    objects.push_back(std::move(obj));
-    return ptr;
+DrawableObject Scene::addGameObject(const char* modelName) {
+    return createObject(getMesh(modelName));
 }
 
 void Scene::clearObjects() {
-    objects.clear();
+    m_Objects.clear();
+    m_MeshesByData.clear();
+    m_MeshesByPath.clear();
     m_Lights.clear();
-    m_SpotLights.clear();
-    m_FireflyPtrs.clear();
+    m_FireflyLights.clear();
     m_FireflyBasePositions.clear();
-    m_FireflyBodyPtrs.clear();
-
-    m_Sun = nullptr;
-    m_Mercury = nullptr;
-    m_Venus = nullptr;
-    m_Earth = nullptr;
-    m_Moon = nullptr;
-    m_Mars = nullptr;
-    m_Jupiter = nullptr;
-    m_Saturn = nullptr;
-    m_Uranus = nullptr;
-    m_Neptune = nullptr;
+    m_FireflyBodies.clear();
+    m_Orbiters.clear();
+
+    m_Sun = DrawableObject();
+    m_Mercury = DrawableObject();
+    m_Venus = DrawableObject();
+    m_Earth = DrawableObject();
+    m_Moon = DrawableObject();
+    m_Mars = DrawableObject();
+    m_Jupiter = DrawableObject();
+    m_Saturn = DrawableObject();
+    m_Uranus = DrawableObject();
+    m_Neptune = DrawableObject();
 
     m_GameTargets.clear();
     m_Score = 0;
     m_GameRunning = false;
     m_GameFinished = false;
+
+    m_TreeMaterial.reset();
+    m_BushMaterial.reset();
+    m_MatShrek.reset();
+    m_MatFiona.reset();
+
+    m_Arena.reset();
 }
 
 void Scene::DrawSkybox(glm::mat4 viewMatrix, glm::mat4 projectionMatrix) const
 {
-    if (!skyboxShader || !skyboxObject) return;
-    glDepthFunc(GL_LEQUAL);
-    glDepthMask(GL_FALSE);
+    if (!skyboxShader || !skyboxModel) return;
+    ZPG_GPU_SCOPE("Skybox");
+    RenderDevice& device = RenderDevice::get();
+    device.depthFunc(GL_LEQUAL);
+    device.depthMask(GL_FALSE);
 
     skyboxShader->use();
     skyboxShader->setMat4("view", viewMatrix);
     skyboxShader->setMat4("projection", projectionMatrix);
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, cubemapTexture);
+    device.activeTexture(GL_TEXTURE0);
+    device.bindTexture(GL_TEXTURE_CUBE_MAP, cubemapTexture);
+    RenderStats::get().countTextureBind();
     skyboxShader->setInt("skybox", 0);
 
-    skyboxObject->draw();
+    skyboxModel->draw();
+    device.useProgram(0);
 
-    glDepthMask(GL_TRUE);
-    glDepthFunc(GL_LESS);
+    device.depthMask(GL_TRUE);
+    device.depthFunc(GL_LESS);
 }
 
-void Scene::render() const {
+// Hloubkovy bucket pro razeni zepredu dozadu
+static uint64_t depthBucket(const Bounds& bounds, const glm::vec3& cameraPosition, const glm::vec3& cameraFront, float farPlane) {
+    const uint64_t DEPTH_BUCKETS = 64;
+
+    glm::vec3 toCenter = bounds.center - cameraPosition;
+    // Objekty obklopujici kameru (skydome, teren) az nakonec: stini jen to, co nic nezakryva
+    if (glm::dot(toCenter, toCenter) <= bounds.radius * bounds.radius) {
+        return DEPTH_BUCKETS;
+    }
+
+    float nearest = glm::dot(toCenter, cameraFront) - bounds.radius;
+    float t = glm::clamp(nearest / farPlane, 0.0f, 1.0f);
+    // sqrt: jemnejsi deleni blizko kamery, kde se prekryva nejvic
+    return (uint64_t)(std::sqrt(t) * (float)(DEPTH_BUCKETS - 1));
+}
+
+void Scene::render(float alpha) {
+    ZPG_PROFILE_SCOPE("Scene::render");
+    ZPG_GPU_SCOPE("Scene");
     if (!camera) return;
+    RenderDevice& device = RenderDevice::get();
+
+    m_Objects.updateNewObjects();
 
     glm::mat4 viewMatrix = camera->getViewMatrix();
     glm::mat4 projectionMatrix = camera->getProjectionMatrix();
 
-    glEnable(GL_STENCIL_TEST);
+    GLint viewport[4];
+    device.getViewport(viewport);
+    m_ViewportPixels = (uint64_t)viewport[2] * (uint64_t)viewport[3];
+
+    device.enable(GL_STENCIL_TEST);
+    device.stencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+
+    // Render system: linearni pruchod hustymi poli storage
+    if (m_ShaderVariants) {
+        const ShaderVariantKey lightingKey = getLightingKey();
+        // DeferredRenderer vola GL primo, bez GPU (NullRenderDevice) se kresli forward
+        const bool deferred = m_RenderPath == RenderPath::Deferred && !device.isNull();
+        m_Lights.upload(m_AmbientLightColor, m_Flashlight);
+        if (!deferred) {
+            // Deferred kresli bodova svetla jako objemy, vyber na objekt nepotrebuje
+            m_LightGrid.build(m_Lights.getPointLights(), m_Lights.getPointLightCount());
+        }
+        const glm::vec3 cameraPosition = camera->getPosition();
+        const glm::vec3 cameraFront = glm::normalize(camera->getFrontVector());
+        const float farPlane = camera->getFarPlane();
+
+        // Klic = hloubkovy bucket << 48 | varianta << 32 | index: zepredu dozadu kvuli
+        // early-Z, v ramci bucketu seskupeno podle varianty shaderu
+        const size_t count = m_Objects.size();
+        FrameVector<uint64_t> drawOrder;
+        drawOrder.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            ShaderVariantKey key = getObjectVariant(i, lightingKey);
+            uint64_t bucket = depthBucket(m_Objects.getWorldBounds(i), cameraPosition, cameraFront, farPlane);
+            drawOrder.push_back((bucket << 48) | ((uint64_t)key.compact() << 32) | (uint64_t)i);
+        }
+        std::sort(drawOrder.begin(), drawOrder.end());
+
+        if (deferred) {
+            renderDeferred(drawOrder, lightingKey, alpha, viewport[2], viewport[3]);
+        }
+        else {
+            renderForward(drawOrder, alpha);
+        }
+    }
 
-    glStencilMask(0x00);
-    glStencilFunc(GL_ALWAYS, 0, 0xFF);
+    // Skybox az po nepruhlednych objektech: v max. hloubce s GL_LEQUAL
+    // se stinuji jen pixely, ktere nic nezakrylo
+    device.stencilMask(0x00);
+    device.stencilFunc(GL_ALWAYS, 0, 0xFF);
+    if (m_SkyboxSamples && skyboxShader) m_SkyboxSamples->begin();
     DrawSkybox(viewMatrix, projectionMatrix);
-    glStencilMask(0xFF);
+    if (m_SkyboxSamples && skyboxShader) m_SkyboxSamples->end();
+    device.stencilMask(0xFF);
 
-    if (colorShaderProgram) {
-        colorShaderProgram->use();
+    device.disable(GL_STENCIL_TEST);
+}
+
+void Scene::renderForward(const FrameVector<uint64_t>& drawOrder, float alpha) {
+    ZPG_GPU_SCOPE("Forward");
+    RenderDevice& device = RenderDevice::get();
+    const glm::vec3 cameraPosition = camera->getPosition();
 
-        colorShaderProgram->setVec3("u_ViewPos", camera->getPosition());
-        colorShaderProgram->setAmbientLight(m_AmbientLightColor);
-        colorShaderProgram->setLights(m_Lights);
-        colorShaderProgram->setSpotLights(m_SpotLights);
-        colorShaderProgram->setFlashlight(*m_Flashlight, m_FlashlightOn);
+    if (m_DepthPrepass && m_DepthPrepassShader) {
+        renderDepthPrepass(drawOrder, alpha);
+        device.depthFunc(GL_EQUAL);
+        device.depthMask(GL_FALSE);
     }
+    m_ShadedSamples->begin();
+
+    // Svetla a kamera se do programu nahraji jen pri jeho prvnim bindu v tomto snimku
+    FrameVector<ShaderProgram*> preparedPrograms;
+    ShaderProgram* program = nullptr;
+    uint32_t boundVariant = 0xFFFFFFFFu;
+    MaterialHandle boundMaterial = ObjectStorage::INVALID_INDEX;
+    GLuint boundTexture = 0;
+
+    for (uint64_t entry : drawOrder) {
+        const uint32_t variant = (uint32_t)((entry >> 32) & 0xFFFFu);
+        const size_t i = (size_t)(entry & 0xFFFFFFFFu);
+
+        if (variant != boundVariant) {
+            boundVariant = variant;
+            // Nehotova varianta se nahradi zaskokem; stejny program se znovu nebinduje
+            ShaderProgram* resolved = &m_ShaderVariants->get(ShaderVariantKey::fromCompact((uint16_t)variant));
+            if (resolved != program) {
+                program = resolved;
+                program->use();
+
+                if (std::find(preparedPrograms.begin(), preparedPrograms.end(), program) == preparedPrograms.end()) {
+                    program->setVec3("u_ViewPos", cameraPosition);
+                    program->setMat4("u_ViewMatrix", program->getViewMatrix());
+                    program->setMat4("u_ProjectionMatrix", program->getProjectionMatrix());
+                    preparedPrograms.push_back(program);
+                }
 
-    glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+                boundMaterial = ObjectStorage::INVALID_INDEX;
+            }
+        }
+
+        if (ShaderVariantKey::fromCompact((uint16_t)variant).pointLights > 0) {
+            // Nejvyznamnejsi bodova svetla prekryvajici objekt, indexy do u_PointLights
+            LightGrid::Selection lights = m_LightGrid.select(m_Objects.getWorldBounds(i));
+            program->setIVec4("u_LightIndices", glm::ivec4(lights.indices[0], lights.indices[1], lights.indices[2], lights.indices[3]));
+            program->setInt("u_ObjectLightCount", lights.count);
+        }
 
-    for (const auto& obj : objects) {
-        glStencilFunc(GL_ALWAYS, obj->getID(), 0xFF);
-        obj->draw();
+        device.stencilFunc(GL_ALWAYS, m_Objects.getID(i), 0xFF);
+        drawObject(*program, i, alpha, boundMaterial, boundTexture);
     }
 
-    glDisable(GL_STENCIL_TEST);
+    m_ShadedSamples->end();
+    if (m_DepthPrepass && m_DepthPrepassShader) {
+        device.depthMask(GL_TRUE);
+        device.depthFunc(GL_LESS);
+    }
+
+    device.bindTexture(GL_TEXTURE_2D, 0);
+    device.useProgram(0);
+}
+
+void Scene::renderDeferred(const FrameVector<uint64_t>& drawOrder, const ShaderVariantKey& lightingKey, float alpha, int width, int height) {
+    if (!m_Deferred) {
+        m_Deferred = std::make_unique<DeferredRenderer>();
+    }
+    // width/height = viewport; kresli se jen do nej, G-buffer ma velikost vystupu
+    m_Deferred->resize(m_OutputWidth > 0 ? std::max(m_OutputWidth, width) : width,
+        m_OutputHeight > 0 ? std::max(m_OutputHeight, height) : height);
+    RenderDevice& device = RenderDevice::get();
+
+    {
+        ZPG_GPU_SCOPE("Deferred geometry");
+        // Geometry pass: G-buffer je sam o sobe hloubkovy prepass, Z-prepass se tu nepouziva
+        m_Deferred->beginGeometryPass();
+
+        ShaderProgram* program = nullptr;
+        uint32_t boundVariant = 0xFFFFFFFFu;
+        MaterialHandle boundMaterial = ObjectStorage::INVALID_INDEX;
+        GLuint boundTexture = 0;
+
+        for (uint64_t entry : drawOrder) {
+            const uint32_t variant = (uint32_t)((entry >> 32) & 0xFFFFu);
+            const size_t i = (size_t)(entry & 0xFFFFFFFFu);
+
+            if (variant != boundVariant) {
+                boundVariant = variant;
+                ShaderProgram* resolved = &m_Deferred->getGeometryProgram(ShaderVariantKey::fromCompact((uint16_t)variant).features);
+                if (resolved != program) {
+                    program = resolved;
+                    program->use();
+                    program->setMat4("u_ViewMatrix", program->getViewMatrix());
+                    program->setMat4("u_ProjectionMatrix", program->getProjectionMatrix());
+                    boundMaterial = ObjectStorage::INVALID_INDEX;
+                }
+            }
+
+            device.stencilFunc(GL_ALWAYS, m_Objects.getID(i), 0xFF);
+            drawObject(*program, i, alpha, boundMaterial, boundTexture);
+        }
+
+        device.bindTexture(GL_TEXTURE_2D, 0);
+        device.useProgram(0);
+        m_Deferred->endGeometryPass();
+    }
+
+    ZPG_GPU_SCOPE("Deferred lighting");
+    m_ShadedSamples->begin();
+    m_Deferred->lightingPass(*camera, lightingKey, m_Lights);
+    m_ShadedSamples->end();
+}
+
+void Scene::drawObject(ShaderProgram& program, size_t i, float alpha, MaterialHandle& boundMaterial, GLuint& boundTexture) {
+    ZPG_PROFILE_DRAW_SCOPE("DrawableObject::draw");
+    ZPG_GPU_DRAW_SCOPE("Draw");
+    RenderDevice& device = RenderDevice::get();
+    MaterialHandle materialHandle = m_Objects.getMaterialHandle(i);
+    if (materialHandle != boundMaterial) {
+        const Material& material = m_Objects.getMaterial(materialHandle);
+        program.setMaterial(material);
+        if (material.diffuseTextureID != 0 && material.diffuseTextureID != boundTexture) {
+            device.activeTexture(GL_TEXTURE0);
+            device.bindTexture(GL_TEXTURE_2D, material.diffuseTextureID);
+            RenderStats::get().countTextureBind();
+            boundTexture = material.diffuseTextureID;
+        }
+        boundMaterial = materialHandle;
+    }
+
+    program.setMat4("u_ModelMatrix", m_Objects.getInterpolatedMatrix(i, alpha));
+    program.setMat3("u_NormalMatrix", m_Objects.getInterpolatedNormalMatrix(i, alpha));
+    m_Objects.getMesh(m_Objects.getMeshHandle(i)).draw();
+}
+
+void Scene::renderDepthPrepass(const FrameVector<uint64_t>& drawOrder, float alpha) {
+    ZPG_GPU_SCOPE("Depth prepass");
+    RenderDevice& device = RenderDevice::get();
+    m_DepthPrepassShader->use();
+    m_DepthPrepassShader->setMat4("u_ViewMatrix", m_DepthPrepassShader->getViewMatrix());
+    m_DepthPrepassShader->setMat4("u_ProjectionMatrix", m_DepthPrepassShader->getProjectionMatrix());
+
+    // Jen hloubka: bez barvy a bez ID do stencilu (ty zapise shading pass)
+    device.colorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    device.stencilMask(0x00);
+
+    for (uint64_t entry : drawOrder) {
+        const size_t i = (size_t)(entry & 0xFFFFFFFFu);
+        m_DepthPrepassShader->setMat4("u_ModelMatrix", m_Objects.getInterpolatedMatrix(i, alpha));
+        m_Objects.getMesh(m_Objects.getMeshHandle(i)).draw();
+    }
+
+    device.stencilMask(0xFF);
+    device.colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+ShaderVariantKey Scene::getLightingKey() const {
+    ShaderVariantKey key;
+    key.dirLights = (uint8_t)m_Lights.getDirLightCount();
+    // Forward shader ma pro bodova svetla jen sloty vybrane LightGridem; shader
+    // cykli do u_ObjectLightCount, varianta je jen "bez svetel" / "vsechny sloty",
+    // takze pridani svetla za behu nevynuti novy preklad
+    key.pointLights = m_Lights.getPointLightCount() > 0 ? (uint8_t)LightGrid::MAX_OBJECT_LIGHTS : 0;
+    key.spotLights = (uint8_t)m_Lights.getSpotLightCount();
+    if (m_FlashlightOn) key.features |= SHADER_FLASHLIGHT;
+    return key;
+}
+
+ShaderVariantKey Scene::getObjectVariant(size_t index, const ShaderVariantKey& lightingKey) const {
+    const Material& material = m_Objects.getMaterial(m_Objects.getMaterialHandle(index));
+    ShaderVariantKey key = lightingKey;
+    key.features |= ShaderVariantKey::objectFeatures(material, (m_Objects.getFlags(index) & OBJECT_UNLIT) != 0);
+    return ShaderVariantManager::normalize(key);
+}
+
+void Scene::prewarmShaders() {
+    if (!m_ShaderVariants) return;
+
+    // Baterka se prepina za behu, pripravi se obe varianty
+    ShaderVariantKey lightingKey = getLightingKey();
+    ShaderVariantKey flashlightKey = lightingKey;
+    flashlightKey.features ^= SHADER_FLASHLIGHT;
+
+    const bool deferred = m_RenderPath == RenderPath::Deferred && !RenderDevice::get().isNull();
+    const size_t count = m_Objects.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (deferred) {
+            if (!m_Deferred) m_Deferred = std::make_unique<DeferredRenderer>();
+            ShaderVariantKey key = getObjectVariant(i, lightingKey);
+            m_Deferred->prewarm(key.features, lightingKey);
+            m_Deferred->prewarm(key.features, flashlightKey);
+        }
+        else {
+            m_ShaderVariants->prewarm(getObjectVariant(i, lightingKey));
+            m_ShaderVariants->prewarm(getObjectVariant(i, flashlightKey));
+        }
+    }
 }
 
 void Scene::update(float deltaTime, int currentSceneIndex) {
+    ZPG_PROFILE_SCOPE("Scene::update");
+    m_Objects.storePreviousMatrices();
+    updateAnimations(deltaTime, currentSceneIndex);
+    m_Objects.updateWorldMatrices();
+}
+
+bool Scene::consumeChanges() {
+    // Vynuluji se vsechny zdroje, i kdyz uz je zmena znama
+    bool changed = m_Changed;
+    m_Changed = false;
+    if (m_Objects.consumeChanged()) changed = true;
+    if (m_Lights.consumeChanged()) changed = true;
+    if (camera && camera->consumeChanged()) changed = true;
+    return changed || m_Objects.isMoving();
+}
+
+void Scene::updateAnimations(float deltaTime, int currentSceneIndex) {
 
     if (m_FlashlightOn) {
         const float rightOffset = 0.15f;
@@ -267,13 +562,13 @@ void Scene::update(float deltaTime, int currentSceneIndex) {
         glm::vec3 camRight = camera->getRightVector();
         glm::vec3 camUp = camera->getUpVector();
 
-        m_Flashlight->position = camPos + (camRight * rightOffset) + (camUp * upOffset);
-        m_Flashlight->direction = camFront;
+        m_Flashlight.position = camPos + (camRight * rightOffset) + (camUp * upOffset);
+        m_Flashlight.direction = camFront;
     }
 
     if (currentSceneIndex == 2) {
         if (!m_Sun) {
-            if (objects.empty()) initSolarSystem();
+            if (m_Objects.size() == 0) initSolarSystem();
             return;
         }
 
@@ -290,20 +585,21 @@ void Scene::update(float deltaTime, int currentSceneIndex) {
         m_MoonOrbitAngle += 3.0f * deltaTime;
 
         // Slunce
-        m_Sun->getTransformation().reset();
-        m_Sun->getTransformation().scale(glm::vec3(2.5f));
-        m_Sun->getTransformation().rotate(m_SelfRotationAngle * 0.2f, glm::vec3(0, 1, 0));
+        m_Sun.getTransformation().reset();
+        m_Sun.getTransformation().scale(glm::vec3(2.5f));
+        m_Sun.getTransformation().rotate(m_SelfRotationAngle * 0.2f, glm::vec3(0, 1, 0));
 
-        auto updatePlanet = [&](int idx, DrawableObject* p) {
+        auto updatePlanet = [&](int idx, const DrawableObject& p) {
             if (!p) return;
-            p->getTransformation().reset();
+            TransformationComposite& t = p.getTransformation();
+            t.reset();
             // Orbit
-            p->getTransformation().rotate(m_OrbitAngles[idx], glm::vec3(0, 1, 0));
-            p->getTransformation().translate(glm::vec3(distances[idx], 0, 0));
+            t.rotate(m_OrbitAngles[idx], glm::vec3(0, 1, 0));
+            t.translate(glm::vec3(distances[idx], 0, 0));
             // Rotace planety
-            p->getTransformation().rotate(m_SelfRotationAngle, glm::vec3(0, 1, 0));
+            t.rotate(m_SelfRotationAngle, glm::vec3(0, 1, 0));
             // Scale
-            p->getTransformation().scale(glm::vec3(sizes[idx]));
+            t.scale(glm::vec3(sizes[idx]));
             };
 
         updatePlanet(0, m_Mercury);
@@ -317,19 +613,19 @@ void Scene::update(float deltaTime, int currentSceneIndex) {
 
         // Mesic
         if (m_Earth && m_Moon) {
-            m_Moon->getTransformation().reset();
-            m_Moon->getTransformation().rotate(m_OrbitAngles[2], glm::vec3(0, 1, 0));
-            m_Moon->getTransformation().translate(glm::vec3(distances[2], 0, 0));
-            m_Moon->getTransformation().rotate(m_MoonOrbitAngle, glm::vec3(0, 1, 0));
-            m_Moon->getTransformation().translate(glm::vec3(1.2f, 0, 0));
-            m_Moon->getTransformation().rotate(glm::radians(90.0f), glm::vec3(0, 1, 0));
-            m_Moon->getTransformation().scale(glm::vec3(0.15f));
+            m_Moon.getTransformation().reset();
+            m_Moon.getTransformation().rotate(m_OrbitAngles[2], glm::vec3(0, 1, 0));
+            m_Moon.getTransformation().translate(glm::vec3(distances[2], 0, 0));
+            m_Moon.getTransformation().rotate(m_MoonOrbitAngle, glm::vec3(0, 1, 0));
+            m_Moon.getTransformation().translate(glm::vec3(1.2f, 0, 0));
+            m_Moon.getTransformation().rotate(glm::radians(90.0f), glm::vec3(0, 1, 0));
+            m_Moon.getTransformation().scale(glm::vec3(0.15f));
         }
     }
 
     if (currentSceneIndex == 3 || currentSceneIndex == 4) {
         m_FireflyTime += deltaTime * 0.5f;
-        for (size_t i = 0; i < m_FireflyPtrs.size(); ++i) {
+        for (size_t i = 0; i < m_FireflyLights.size(); ++i) {
             glm::vec3 basePos = m_FireflyBasePositions[i];
             glm::vec3 offset;
             offset.x = sin(m_FireflyTime + i * 2.1f) * 2.0f;
@@ -337,14 +633,16 @@ void Scene::update(float deltaTime, int currentSceneIndex) {
             offset.z = sin(m_FireflyTime + i * 0.8f) * 2.0f;
 
             glm::vec3 newPos = basePos + offset;
-            m_FireflyPtrs[i]->position = newPos;
+            // Primo v poli svetel, odtud jde pozice do UBO
+            m_Lights.pointLight(m_FireflyLights[i]).position = newPos;
 
-            if (i < m_FireflyBodyPtrs.size()) {
-                m_FireflyBodyPtrs[i]->getTransformation().reset();
-                m_FireflyBodyPtrs[i]->getTransformation().translate(newPos);
+            if (i < m_FireflyBodies.size() && m_FireflyBodies[i]) {
+                TransformationComposite& t = m_FireflyBodies[i].getTransformation();
+                t.reset();
+                t.translate(newPos);
 
                 float scale = (currentSceneIndex == 3) ? 0.03f : 0.15f;
-                m_FireflyBodyPtrs[i]->getTransformation().scale(glm::vec3(scale));
+                t.scale(glm::vec3(scale));
             }
         }
     }
@@ -352,6 +650,22 @@ void Scene::update(float deltaTime, int currentSceneIndex) {
     if (currentSceneIndex == 4) {
         updateGame(deltaTime);
     }
+
+    updateOrbiters(deltaTime);
+}
+
+void Scene::updateOrbiters(float deltaTime) {
+    for (Orbiter& orbiter : m_Orbiters) {
+        orbiter.angle += orbiter.speed * deltaTime;
+
+        DrawableObject obj = getObjectByID(orbiter.objectID);
+        if (!obj) continue;
+        TransformationComposite& t = obj.getTransformation();
+        t.reset();
+        t.translate(orbiter.center + glm::vec3(std::cos(orbiter.angle), 0.0f, std::sin(orbiter.angle)) * orbiter.radius);
+        t.rotate(-orbiter.angle, glm::vec3(0, 1, 0));
+        t.scale(glm::vec3(orbiter.scale));
+    }
 }
 
 void Scene::setPlayerName(std::string name) {
@@ -362,14 +676,14 @@ void Scene::setPlayerName(std::string name) {
 
 void Scene::initGameMaterials() {
     if (!m_MatShrek) {
-        m_MatShrek = std::make_shared<Material>();
+        m_MatShrek = createMaterial();
         m_MatShrek->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
         m_MatShrek->specular = glm::vec3(0.1f, 0.1f, 0.1f);
         m_MatShrek->shininess = 32.0f;
         m_MatShrek->diffuseTextureID = TextureLoader::LoadTexture("assets/shrek/shrek.png");
     }
     if (!m_MatFiona) {
-        m_MatFiona = std::make_shared<Material>();
+        m_MatFiona = createMaterial();
         m_MatFiona->diffuse = glm::vec3(1.0f, 1.0f, 1.0f);
         m_MatFiona->specular = glm::vec3(0.1f, 0.1f, 0.1f);
         m_MatFiona->shininess = 32.0f;
@@ -377,14 +691,14 @@ void Scene::initGameMaterials() {
     }
 
     if (!m_TreeMaterial) {
-        m_TreeMaterial = std::make_shared<Material>();
+        m_TreeMaterial = createMaterial();
         m_TreeMaterial->diffuse = glm::vec3(0.2f, 0.5f, 0.2f);
         m_TreeMaterial->ambient = glm::vec3(0.1f, 0.3f, 0.1f);
         m_TreeMaterial->specular = glm::vec3(0.2f, 0.2f, 0.2f);
         m_TreeMaterial->shininess = 32.0f;
     }
     if (!m_BushMaterial) {
-        m_BushMaterial = std::make_shared<Material>();
+        m_BushMaterial = createMaterial();
         m_BushMaterial->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
         m_BushMaterial->ambient = glm::vec3(0.1f, 0.3f, 0.1f);
         m_BushMaterial->specular = glm::vec3(0.1f, 0.1f, 0.1f);
@@ -417,14 +731,14 @@ void Scene::spawnGameTarget() {
 
     bool isShrek = (std::rand() % 2) == 0;
 
-    DrawableObject* newObj = nullptr;
+    DrawableObject newObj;
     if (isShrek) {
         newObj = addGameObject("assets/shrek/shrek.obj");
-        newObj->setMaterial(m_MatShrek);
+        newObj.setMaterial(m_MatShrek);
     }
     else {
         newObj = addGameObject("assets/shrek/fiona.obj");
-        newObj->setMaterial(m_MatFiona);
+        newObj.setMaterial(m_MatFiona);
     }
 
     glm::vec3 A = glm::vec3(randomX, -4.0f, randomZ);
@@ -432,7 +746,7 @@ void Scene::spawnGameTarget() {
     glm::vec3 C = glm::vec3(randomX + (isShrek ? 3.0f : -3.0f), -4.0f, randomZ);
 
     GameTarget target;
-    target.objectID = newObj->getID();
+    target.objectID = newObj.getID();
     target.t = 0.0f;
     target.speed = 0.8f + (std::rand() % 120) / 100.0f;
     target.pointA = A;
@@ -442,10 +756,11 @@ void Scene::spawnGameTarget() {
     target.isHit = false;
     target.currentRotation = (float)(std::rand() % 360);
 
-    newObj->getTransformation().reset();
-    newObj->getTransformation().translate(A);
-    newObj->getTransformation().scale(glm::vec3(2.0f));
-    newObj->getTransformation().rotate(target.currentRotation, glm::vec3(0, 1, 0));
+    TransformationComposite& t = newObj.getTransformation();
+    t.reset();
+    t.translate(A);
+    t.scale(glm::vec3(2.0f));
+    t.rotate(target.currentRotation, glm::vec3(0, 1, 0));
 
     m_GameTargets.push_back(target);
 }
@@ -491,27 +806,23 @@ void Scene::updateGame(float deltaTime) {
 
         tgt.currentRotation += 100.0f * deltaTime;
 
-        DrawableObject* obj = getObjectByID(tgt.objectID);
+        DrawableObject obj = getObjectByID(tgt.objectID);
         if (obj) {
-            obj->getTransformation().reset();
-            obj->getTransformation().translate(currentPos);
+            TransformationComposite& t = obj.getTransformation();
+            t.reset();
+            t.translate(currentPos);
 
             if (tgt.isHit) {
-                obj->getTransformation().scale(glm::vec3(0.5f));
+                t.scale(glm::vec3(0.5f));
             }
             else {
-                obj->getTransformation().scale(glm::vec3(2.0f));
+                t.scale(glm::vec3(2.0f));
             }
-            obj->getTransformation().rotate(tgt.currentRotation, glm::vec3(0, 1, 0));
+            t.rotate(tgt.currentRotation, glm::vec3(0, 1, 0));
         }
 
         if (tgt.t >= 2.0f) {
-            for (auto oIt = objects.begin(); oIt != objects.end(); ++oIt) {
-                if ((*oIt)->getID() == tgt.objectID) {
-                    objects.erase(oIt);
-                    break;
-                }
-            }
+            m_Objects.destroy(tgt.objectID);
             it = m_GameTargets.erase(it);
         }
         else {
@@ -539,111 +850,123 @@ void Scene::hitObject(unsigned int id) {
     }
 }
 
-DrawableObject* Scene::getFirstObject() {
-    if (objects.empty()) return nullptr;
-    return objects.front().get();
+DrawableObject Scene::getFirstObject() {
+    return getObject(0);
 }
 
-DrawableObject* Scene::getObject(size_t index) {
-    if (index >= objects.size()) return nullptr;
-    return objects[index].get();
+DrawableObject Scene::getObject(size_t index) {
+    if (index >= m_Objects.size()) return DrawableObject();
+    return DrawableObject(m_Objects, m_Objects.getID(index));
 }
 
 void Scene::setAmbientLight(const glm::vec3& color) {
     m_AmbientLightColor = color;
+    m_Changed = true;
 }
 
-DirLight* Scene::addDirLight(const glm::vec3& dir, const glm::vec3& col) {
-    auto newLight = std::make_unique<DirLight>(dir, col);
-    DirLight* ptr = newLight.get();
-    m_Lights.push_back(std::move(newLight));
-    return ptr;
+LightHandle Scene::addDirLight(const glm::vec3& dir, const glm::vec3& col) {
+    return m_Lights.addDirLight(DirLight(dir, col));
 }
 
-PointLight* Scene::addPointLight(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic) {
-    auto newLight = std::make_unique<PointLight>(pos, col, constant, linear, quadratic);
-    PointLight* ptr = newLight.get();
-    m_Lights.push_back(std::move(newLight));
-    return ptr;
+LightHandle Scene::addPointLight(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic) {
+    return m_Lights.addPointLight(PointLight(pos, col, constant, linear, quadratic));
 }
 
-PointLight* Scene::addFirefly(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic) {
-    auto newLight = std::make_unique<PointLight>(pos, col, constant, linear, quadratic);
-    PointLight* ptr = newLight.get();
-    m_Lights.push_back(std::move(newLight));
+LightHandle Scene::addFirefly(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic) {
+    LightHandle handle = m_Lights.addPointLight(PointLight(pos, col, constant, linear, quadratic));
 
-    m_FireflyPtrs.push_back(ptr);
+    m_FireflyLights.push_back(handle);
     m_FireflyBasePositions.push_back(pos);
 
-    return ptr;
+    return handle;
 }
 
-SpotLight* Scene::addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& col, float c, float l, float q, float cut, float outerCut) {
-    auto newLight = std::make_unique<SpotLight>(pos, dir, col, c, l, q, cut, outerCut);
-    SpotLight* ptr = newLight.get();
-    m_SpotLights.push_back(std::move(newLight));
-    return ptr;
+LightHandle Scene::addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& col, float c, float l, float q, float cut, float outerCut) {
+    return m_Lights.addSpotLight(SpotLight(pos, dir, col, c, l, q, cut, outerCut));
 }
 
-void Scene::addFireflyBody(DrawableObject* body) {
-    m_FireflyBodyPtrs.push_back(body);
+void Scene::addFireflyBody(DrawableObject body) {
+    m_FireflyBodies.push_back(body);
 }
 
 void Scene::toggleFlashlight() {
     m_FlashlightOn = !m_FlashlightOn;
+    m_Changed = true;
 }
 
-DrawableObject* Scene::getObjectByID(unsigned int id) {
-    for (const auto& obj : objects) {
-        if (obj->getID() == id) {
-            return obj.get();
-        }
+void Scene::toggleRenderPath() {
+    m_RenderPath = (m_RenderPath == RenderPath::Forward) ? RenderPath::Deferred : RenderPath::Forward;
+    m_Changed = true;
+    std::cout << "Render path: " << (m_RenderPath == RenderPath::Deferred ? "deferred" : "forward") << std::endl;
+    prewarmShaders();
+}
+
+void Scene::toggleDepthPrepass() {
+    // Vysledky z dosavadniho rezimu, pro porovnani obou
+    printFragmentStats();
+    m_DepthPrepass = !m_DepthPrepass;
+    m_Changed = true;
+    std::cout << "Depth prepass " << (m_DepthPrepass ? "ON" : "OFF") << std::endl;
+}
+
+void Scene::printFragmentStats() const {
+    uint64_t skySamples = getSkyboxSamples();
+    uint64_t skySkipped = (skyboxShader && m_ViewportPixels > skySamples) ? m_ViewportPixels - skySamples : 0;
+    std::cout << "Fragments (prepass " << (m_DepthPrepass ? "on" : "off") << "): objects shaded " << getShadedSamples()
+        << ", skybox shaded " << skySamples << ", skybox skipped " << skySkipped
+        << " of " << m_ViewportPixels << " pixels" << std::endl;
+}
+
+DrawableObject Scene::getObjectByID(unsigned int id) {
+    if (m_Objects.indexOf(id) == ObjectStorage::INVALID_INDEX) {
+        return DrawableObject();
     }
-    return nullptr;
+    return DrawableObject(m_Objects, id);
 }
 
 void Scene::selectObjectByID(unsigned int id) {
-    DrawableObject* selected = getObjectByID(id);
+    DrawableObject selected = getObjectByID(id);
     if (selected) {
     }
 }
 
 void Scene::addTreeAt(glm::vec3 position, float scale) {
     if (!m_TreeMaterial) {
-        m_TreeMaterial = std::make_shared<Material>();
+        m_TreeMaterial = createMaterial();
         m_TreeMaterial->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
         m_TreeMaterial->ambient = glm::vec3(0.1f, 0.4f, 0.1f);
         m_TreeMaterial->specular = glm::vec3(0.1f, 0.1f, 0.1f);
         m_TreeMaterial->shininess = 16.0f;
     }
 
-    std::unique_ptr<Model> m = std::make_unique<Model>(tree, sizeof(tree), 6);
-    std::unique_ptr<DrawableObject> obj = std::make_unique<DrawableObject>(std::move(m), colorShaderProgram);
-
-    m_ObjectCounter++;
-    obj->setID(m_ObjectCounter);
-    obj->setMaterial(m_TreeMaterial);
-    obj->getTransformation().translate(position).scale(glm::vec3(scale));
-
-    objects.push_back(std::move(obj));
+    DrawableObject obj = createObject(getMesh(tree, sizeof(tree), 6));
+    obj.setMaterial(m_TreeMaterial);
+    obj.getTransformation().translate(position).scale(glm::vec3(scale));
 }
 
 void Scene::addBushAt(glm::vec3 position, float scale) {
     if (!m_BushMaterial) {
-        m_BushMaterial = std::make_shared<Material>();
+        m_BushMaterial = createMaterial();
         m_BushMaterial->diffuse = glm::vec3(0.1f, 0.4f, 0.1f);
         m_BushMaterial->ambient = glm::vec3(0.1f, 0.3f, 0.1f);
         m_BushMaterial->specular = glm::vec3(0.1f, 0.1f, 0.1f);
         m_BushMaterial->shininess = 16.0f;
     }
 
-    std::unique_ptr<Model> m = std::make_unique<Model>(bushes, sizeof(bushes), 6);
-    std::unique_ptr<DrawableObject> obj = std::make_unique<DrawableObject>(std::move(m), colorShaderProgram);
-
-    m_ObjectCounter++;
-    obj->setID(m_ObjectCounter);
-    obj->setMaterial(m_BushMaterial);
-    obj->getTransformation().translate(position).scale(glm::vec3(scale));
+    DrawableObject obj = createObject(getMesh(bushes, sizeof(bushes), 6));
+    obj.setMaterial(m_BushMaterial);
+    obj.getTransformation().translate(position).scale(glm::vec3(scale));
+}
 
-    objects.push_back(std::move(obj));
+void Scene::addOrbiter(DrawableObject object, const glm::vec3& center, float radius, float speed, float scale) {
+    if (!object) return;
+
+    Orbiter orbiter;
+    orbiter.objectID = object.getID();
+    orbiter.center = center;
+    orbiter.radius = radius;
+    orbiter.speed = speed;
+    orbiter.angle = 0.0f;
+    orbiter.scale = scale;
+    m_Orbiters.push_back(orbiter);
 }
\ No newline at end of file
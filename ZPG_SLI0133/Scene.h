@@ -2,19 +2,29 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <GL/glew.h>
 #include <glm/glm.hpp>
-#include "Lights.h"
+#include "LightStorage.h"
+#include "LightGrid.h"
+#include "DrawableObject.h"
+#include "ObjectStorage.h"
+#include "SceneArena.h"
+#include "ShaderVariantManager.h"
+#include "SampleCounter.h"
+#include "FrameAllocator.h"
 
-class DrawableObject;
 class ShaderProgram;
 class Camera;
 class Model;
 class TransformationComposite;
-class DirLight;
-class PointLight;
-class SpotLight;
 class Material;
+class DeferredRenderer;
+
+enum class RenderPath {
+    Forward,
+    Deferred,
+};
 
 struct GameTarget {
     unsigned int objectID;
@@ -28,41 +38,80 @@ struct GameTarget {
     float currentRotation;
 };
 
+// Objekt obihajici po kruznici; transformace se prepocita kazdy krok simulace
+struct Orbiter {
+    unsigned int objectID;
+    glm::vec3 center;
+    float radius;
+    float speed;
+    float angle;
+    float scale;
+};
+
 class Scene
 {
 public:
     Scene();
-    ~Scene() = default;
+    ~Scene();
 
     void createShaders(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
+    // Zada asynchronni preklad vsech variant, ktere objekty sceny pouzivaji
+    void prewarmShaders();
     void addObject(const float* data, size_t size, int stride);
     void addObject(const char* modelName);
 
-    DrawableObject* addGameObject(const char* modelName);
+    DrawableObject addGameObject(const char* modelName);
+
+    // Materialy sceny ziji v jeji arene a uvolni se v clearObjects()
+    std::shared_ptr<Material> createMaterial();
+    const SceneArena::Stats& getArenaStats() const { return m_Arena.getStats(); }
 
     void clearObjects();
-    void render() const;
+    void render(float alpha = 1.0f);
+    // Velikost vystupniho framebufferu, podle ni se alokuje G-buffer; 0 = podle viewportu.
+    // Dynamicke rozliseni zmensuje jen viewport, zmena meritka tak G-buffer nealokuje.
+    void setOutputSize(int width, int height) { m_OutputWidth = width; m_OutputHeight = height; }
     void update(float deltaTime, int currentSceneIndex);
+    // On-demand kresleni: zmenila se od posledniho dotazu kamera, objekty, svetla
+    // nebo nastaveni sceny? Pohyb objektu plati, dokud se nezastavi.
+    bool consumeChanges();
 
-    DrawableObject* getFirstObject();
-    DrawableObject* getObject(size_t index);
-    size_t getObjectCount() const { return objects.size(); }
+    DrawableObject getFirstObject();
+    DrawableObject getObject(size_t index);
+    size_t getObjectCount() const { return m_Objects.size(); }
     Camera& getCamera() { return *camera; }
 
     void setAmbientLight(const glm::vec3& color);
-    DirLight* addDirLight(const glm::vec3& dir, const glm::vec3& col);
-    PointLight* addPointLight(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic);
-    PointLight* addFirefly(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic);
-    SpotLight* addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& col, float c, float l, float q, float cut, float outerCut);
-    void addFireflyBody(DrawableObject* body);
+    // Handle je index do pole svetel daneho typu (LightStorage)
+    LightHandle addDirLight(const glm::vec3& dir, const glm::vec3& col);
+    LightHandle addPointLight(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic);
+    LightHandle addFirefly(const glm::vec3& pos, const glm::vec3& col, float constant, float linear, float quadratic);
+    LightHandle addSpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& col, float c, float l, float q, float cut, float outerCut);
+    void addFireflyBody(DrawableObject body);
     void toggleFlashlight();
+
+    // Z-prepass: nejdriv jen hloubka, pak shading s GL_EQUAL (kazdy pixel se stinuje jednou)
+    void setDepthPrepass(bool enabled) { m_DepthPrepass = enabled; m_Changed = true; }
+    bool isDepthPrepassEnabled() const { return m_DepthPrepass; }
+    void toggleDepthPrepass();
+
+    // Deferred: cena svetel nezavisi na geometrii (hodne bodovych svetel, napr. svetlusky)
+    void setRenderPath(RenderPath path) { m_RenderPath = path; m_Changed = true; }
+    RenderPath getRenderPath() const { return m_RenderPath; }
+    void toggleRenderPath();
+    // Vzorky, ktere prosly depth testem v shading passu (o par snimku starsi)
+    uint64_t getShadedSamples() const { return m_ShadedSamples ? m_ShadedSamples->getLastResult() : 0; }
+    // Skybox se kresli po objektech; zakryte pixely se vubec nestinuji
+    uint64_t getSkyboxSamples() const { return m_SkyboxSamples ? m_SkyboxSamples->getLastResult() : 0; }
+    void printFragmentStats() const;
     void InitSkybox();
     void DrawSkybox(glm::mat4 viewMatrix, glm::mat4 projectionMatrix) const;
 
     void selectObjectByID(unsigned int id);
     void addTreeAt(glm::vec3 position, float scale = 0.5f);
     void addBushAt(glm::vec3 position, float scale = 0.5f);
-    DrawableObject* getObjectByID(unsigned int id);
+    void addOrbiter(DrawableObject object, const glm::vec3& center, float radius, float speed, float scale = 1.0f);
+    DrawableObject getObjectByID(unsigned int id);
 
     // --- Solar System Methods ---
     void initSolarSystem();
@@ -76,23 +125,51 @@ public:
     void hitObject(unsigned int id);
 
 private:
-    std::vector<std::unique_ptr<DrawableObject>> objects;
-    std::shared_ptr<ShaderProgram> colorShaderProgram;
-    std::unique_ptr<Camera> camera;
+    MeshHandle getMesh(const float* data, size_t size, int stride);
+    MeshHandle getMesh(const char* modelName);
+    DrawableObject createObject(MeshHandle mesh);
+    ShaderVariantKey getLightingKey() const;
+    ShaderVariantKey getObjectVariant(size_t index, const ShaderVariantKey& lightingKey) const;
+    void renderForward(const FrameVector<uint64_t>& drawOrder, float alpha);
+    void renderDeferred(const FrameVector<uint64_t>& drawOrder, const ShaderVariantKey& lightingKey, float alpha, int width, int height);
+    void renderDepthPrepass(const FrameVector<uint64_t>& drawOrder, float alpha);
+    void drawObject(ShaderProgram& program, size_t index, float alpha, MaterialHandle& boundMaterial, GLuint& boundTexture);
+    void updateAnimations(float deltaTime, int currentSceneIndex);
+    void updateOrbiters(float deltaTime);
+
+    // Musi byt deklarovana pred vsim, co z ni alokuje (nici se posledni)
+    SceneArena m_Arena;
+    ObjectStorage m_Objects;
+    std::unordered_map<const float*, MeshHandle> m_MeshesByData;
+    std::unordered_map<std::string, MeshHandle> m_MeshesByPath;
 
-    std::vector<std::unique_ptr<Light>> m_Lights;
-    std::vector<std::unique_ptr<SpotLight>> m_SpotLights;
-    std::unique_ptr<SpotLight> m_Flashlight;
+    std::unique_ptr<Camera> camera;
+    std::unique_ptr<ShaderVariantManager> m_ShaderVariants;
+    std::shared_ptr<ShaderProgram> m_DepthPrepassShader;
+    std::unique_ptr<SampleCounter> m_ShadedSamples;
+    std::unique_ptr<SampleCounter> m_SkyboxSamples;
+    uint64_t m_ViewportPixels = 0;
+    int m_OutputWidth = 0;
+    int m_OutputHeight = 0;
+    bool m_DepthPrepass = false;
+    std::unique_ptr<DeferredRenderer> m_Deferred;
+    RenderPath m_RenderPath = RenderPath::Forward;
+    bool m_Changed = true;
+
+    LightStorage m_Lights;
+    LightGrid m_LightGrid;
+    SpotLight m_Flashlight;
     bool m_FlashlightOn;
     glm::vec3 m_AmbientLightColor;
 
     float m_FireflyTime;
-    std::vector<PointLight*> m_FireflyPtrs;
+    std::vector<LightHandle> m_FireflyLights;
     std::vector<glm::vec3> m_FireflyBasePositions;
-    std::vector<DrawableObject*> m_FireflyBodyPtrs;
+    std::vector<DrawableObject> m_FireflyBodies;
+    std::vector<Orbiter> m_Orbiters;
 
     std::shared_ptr<ShaderProgram> skyboxShader;
-    std::unique_ptr<DrawableObject> skyboxObject;
+    std::unique_ptr<Model> skyboxModel;
     GLuint cubemapTexture;
 
     size_t m_ObjectCounter = 0;
@@ -103,16 +180,16 @@ private:
     std::shared_ptr<Material> m_MatFiona;
 
     // --- Solar System Pointers ---
-    DrawableObject* m_Sun = nullptr;
-    DrawableObject* m_Mercury = nullptr;
-    DrawableObject* m_Venus = nullptr;
-    DrawableObject* m_Earth = nullptr;
-    DrawableObject* m_Moon = nullptr;
-    DrawableObject* m_Mars = nullptr;
-    DrawableObject* m_Jupiter = nullptr;
-    DrawableObject* m_Saturn = nullptr;
-    DrawableObject* m_Uranus = nullptr;
-    DrawableObject* m_Neptune = nullptr;
+    DrawableObject m_Sun;
+    DrawableObject m_Mercury;
+    DrawableObject m_Venus;
+    DrawableObject m_Earth;
+    DrawableObject m_Moon;
+    DrawableObject m_Mars;
+    DrawableObject m_Jupiter;
+    DrawableObject m_Saturn;
+    DrawableObject m_Uranus;
+    DrawableObject m_Neptune;
 
     // Animation angles
     float m_OrbitAngles[8] = { 0.0f }; // One for each planet
@@ -0,0 +1,91 @@
+#include "SceneArena.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+SceneArena::SceneArena(size_t chunkSize)
+    : m_ChunkSize(chunkSize) {
+}
+
+SceneArena::~SceneArena() {
+}
+
+void* SceneArena::allocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+    m_Stats.allocations++;
+    m_Stats.liveAllocations++;
+
+    if (isPooled(size, alignment)) {
+        size_t bucket = bucketIndex(size);
+        if (FreeBlock* block = m_FreeLists[bucket]) {
+            m_FreeLists[bucket] = block->next;
+            m_Stats.recycledAllocations++;
+            return block;
+        }
+        // Blok se zaokrouhli na velikost bucketu, aby sel pozdeji recyklovat
+        return allocateFromChunks((bucket + 1) * BUCKET_GRANULARITY, BUCKET_GRANULARITY);
+    }
+
+    return allocateFromChunks(size, alignment);
+}
+
+void SceneArena::deallocate(void* ptr, size_t size, size_t alignment) {
+    if (!ptr) return;
+    if (size == 0) size = 1;
+    m_Stats.liveAllocations--;
+
+    // Velke a vic zarovnane bloky se vrati az pri reset()
+    if (isPooled(size, alignment)) {
+        size_t bucket = bucketIndex(size);
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = m_FreeLists[bucket];
+        m_FreeLists[bucket] = block;
+    }
+}
+
+void* SceneArena::allocateFromChunks(size_t size, size_t alignment) {
+    while (m_CurrentChunk < m_Chunks.size()) {
+        Chunk& chunk = m_Chunks[m_CurrentChunk];
+        uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data.get());
+        uintptr_t aligned = (base + chunk.used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+        size_t offset = aligned - base;
+
+        if (offset + size <= chunk.size) {
+            m_Stats.bytesUsed += offset + size - chunk.used;
+            chunk.used = offset + size;
+            return chunk.data.get() + offset;
+        }
+        m_CurrentChunk++;
+    }
+
+    size_t chunkSize = std::max(m_ChunkSize, size + alignment);
+    Chunk chunk;
+    chunk.data = std::make_unique<unsigned char[]>(chunkSize);
+    chunk.size = chunkSize;
+    chunk.used = 0;
+    m_Chunks.push_back(std::move(chunk));
+    m_CurrentChunk = m_Chunks.size() - 1;
+
+    m_Stats.bytesReserved += chunkSize;
+    m_Stats.chunks = m_Chunks.size();
+
+    return allocateFromChunks(size, alignment);
+}
+
+void SceneArena::reset() {
+    // Vsichni vlastnici (ArenaPtr, shared_ptr materialu) musi byt touto dobou pryc
+    assert(m_Stats.liveAllocations == 0 && "SceneArena::reset with live allocations");
+
+    for (Chunk& chunk : m_Chunks) {
+        chunk.used = 0;
+    }
+    m_CurrentChunk = 0;
+    for (FreeBlock*& head : m_FreeLists) {
+        head = nullptr;
+    }
+
+    m_Stats.bytesUsed = 0;
+    m_Stats.allocations = 0;
+    m_Stats.recycledAllocations = 0;
+    m_Stats.liveAllocations = 0;
+}
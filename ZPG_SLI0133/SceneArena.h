@@ -0,0 +1,116 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+#include <utility>
+
+// Bump alokator s dobou zivota sceny. Pamet se uvolnuje najednou v reset(),
+// male bloky vracene pres deallocate() se recykluji.
+class SceneArena {
+public:
+    struct Stats {
+        size_t bytesUsed = 0;
+        size_t bytesReserved = 0;
+        size_t allocations = 0;
+        size_t recycledAllocations = 0;
+        size_t liveAllocations = 0;
+        size_t chunks = 0;
+    };
+
+    explicit SceneArena(size_t chunkSize = 64 * 1024);
+    ~SceneArena();
+
+    SceneArena(const SceneArena&) = delete;
+    SceneArena& operator=(const SceneArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+    // size a alignment musi byt stejne jako pri allocate()
+    void deallocate(void* ptr, size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Vse alokovane se zahodi najednou, chunky zustanou pro dalsi naplneni sceny
+    void reset();
+
+    const Stats& getStats() const { return m_Stats; }
+
+private:
+    struct Chunk {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static const size_t BUCKET_GRANULARITY = 16;
+    static const size_t BUCKET_COUNT = 16;
+
+    static size_t bucketIndex(size_t size) { return (size + BUCKET_GRANULARITY - 1) / BUCKET_GRANULARITY - 1; }
+    // Stejne pravidlo pro allocate i deallocate: vetsi zarovnani se nerecykluje
+    static bool isPooled(size_t size, size_t alignment) {
+        return size <= BUCKET_GRANULARITY * BUCKET_COUNT && alignment <= BUCKET_GRANULARITY;
+    }
+
+    void* allocateFromChunks(size_t size, size_t alignment);
+
+    size_t m_ChunkSize;
+    std::vector<Chunk> m_Chunks;
+    size_t m_CurrentChunk = 0;
+    FreeBlock* m_FreeLists[BUCKET_COUNT] = {};
+    Stats m_Stats;
+};
+
+// Deleter pro objekty v arene; bez areny se chova jako obycejny delete
+struct ArenaDeleter {
+    SceneArena* arena = nullptr;
+    size_t size = 0;
+    size_t alignment = alignof(std::max_align_t);
+
+    template<typename T>
+    void operator()(T* ptr) const {
+        if (!ptr) return;
+        ptr->~T();
+        if (arena) arena->deallocate(ptr, size, alignment);
+        else ::operator delete(ptr);
+    }
+};
+
+template<typename T>
+using ArenaPtr = std::unique_ptr<T, ArenaDeleter>;
+
+template<typename T, typename... Args>
+ArenaPtr<T> makeArenaPtr(SceneArena* arena, Args&&... args) {
+    void* memory = arena ? arena->allocate(sizeof(T), alignof(T)) : ::operator new(sizeof(T));
+    T* object = new (memory) T(std::forward<Args>(args)...);
+    return ArenaPtr<T>(object, ArenaDeleter{ arena, sizeof(T), alignof(T) });
+}
+
+// STL alokator nad arenou (napr. pro std::allocate_shared)
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(SceneArena* arena) : m_Arena(arena) {}
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_Arena(other.getArena()) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(m_Arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* ptr, size_t n) {
+        m_Arena->deallocate(ptr, n * sizeof(T), alignof(T));
+    }
+
+    SceneArena* getArena() const { return m_Arena; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return m_Arena == other.getArena(); }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return m_Arena != other.getArena(); }
+
+private:
+    SceneArena* m_Arena;
+};
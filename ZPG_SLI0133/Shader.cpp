@@ -1,35 +1,65 @@
 #include "Shader.h"
+#include "RenderDevice.h"
 #include <stdexcept>
 #include <fstream>
 #include <iostream>
 
 void Shader::checkCompileErrors() {
-    GLint success;
-    glGetShaderiv(this->id, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        char infoLog[512];
-        glGetShaderInfoLog(this->id, 512, NULL, infoLog);
+    if (!RenderDevice::get().getShaderi(this->id, GL_COMPILE_STATUS)) {
+        std::string infoLog = RenderDevice::get().getShaderInfoLog(this->id);
 
-        fprintf(stderr, "SHADER_COMPILATION_ERROR:\n%s\n", infoLog);
+        fprintf(stderr, "SHADER_COMPILATION_ERROR:\n%s\n", infoLog.c_str());
         throw std::runtime_error("Shader compilation failed.");
     }
 }
 
-void Shader::createShader(GLenum shaderType, const char* shaderCode) {
-    GLuint shaderID = glCreateShader(shaderType);
-    glShaderSource(shaderID, 1, &shaderCode, NULL);
-    glCompileShader(shaderID);
+void Shader::createShader(GLenum shaderType, const char* shaderCode, bool checkErrors) {
+    RenderDevice& device = RenderDevice::get();
+    GLuint shaderID = device.createShader(shaderType);
+    device.shaderSource(shaderID, shaderCode);
+    device.compileShader(shaderID);
     this->id = shaderID;
 
-    checkCompileErrors();
+    // Dotaz na GL_COMPILE_STATUS ceka na dokonceni prekladu
+    if (checkErrors) {
+        checkCompileErrors();
+    }
+}
+
+Shader::Shader(GLenum shaderType, const char* shaderFile, const std::string& defines) : id(0)
+{
+	createShaderFromFile(shaderType, shaderFile, defines);
 }
 
-Shader::Shader(GLenum shaderType, const char* shaderFile) : id(0)
+Shader::~Shader()
 {
-	createShaderFromFile(shaderType, shaderFile);
+    // Pripojeny shader se smaze az s programem
+    if (this->id != 0) {
+        RenderDevice::get().deleteShader(this->id);
+    }
 }
 
-void Shader::createShaderFromFile(GLenum shaderType, const char* shaderFile)
+static void injectDefines(std::string& shaderCode, const std::string& defines)
+{
+    if (defines.empty()) return;
+
+    // #version musi zustat prvni direktivou
+    size_t versionPos = shaderCode.find("#version");
+    size_t insertPos = 0;
+    if (versionPos != std::string::npos) {
+        size_t lineEnd = shaderCode.find('\n', versionPos);
+        if (lineEnd == std::string::npos) {
+            shaderCode += '\n';
+            insertPos = shaderCode.size();
+        }
+        else {
+            insertPos = lineEnd + 1;
+        }
+    }
+    shaderCode.insert(insertPos, defines);
+}
+
+static std::string readSource(const char* shaderFile)
 {
     std::ifstream file(shaderFile);
     if (!file.is_open())
@@ -38,9 +68,57 @@ void Shader::createShaderFromFile(GLenum shaderType, const char* shaderFile)
         exit(-1);
     }
     std::string shaderCode((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    // UTF-8 BOM pred #version nektere ovladace odmitnou
+    if (shaderCode.compare(0, 3, "\xEF\xBB\xBF") == 0) shaderCode.erase(0, 3);
+    return shaderCode;
+}
 
-   createShader(shaderType, shaderCode.c_str());
+// GLSL 330 #include nezna: radek #include "soubor" se nahradi obsahem souboru
+// (sdileny kod vice shaderu, napr. deferred_common.glsl)
+static void expandIncludes(std::string& shaderCode, int depth)
+{
+    const int MAX_INCLUDE_DEPTH = 4;
+    size_t pos = 0;
+    while ((pos = shaderCode.find("#include", pos)) != std::string::npos) {
+        if (pos > 0 && shaderCode[pos - 1] != '\n') {
+            pos += 8;
+            continue;
+        }
+        size_t lineEnd = shaderCode.find('\n', pos);
+        if (lineEnd == std::string::npos) lineEnd = shaderCode.size();
+        size_t nameStart = shaderCode.find('"', pos);
+        size_t nameEnd = nameStart < lineEnd ? shaderCode.find('"', nameStart + 1) : std::string::npos;
+        if (nameEnd == std::string::npos || nameEnd > lineEnd || depth >= MAX_INCLUDE_DEPTH) {
+            fprintf(stderr, "Invalid shader #include: %s\n", shaderCode.substr(pos, lineEnd - pos).c_str());
+            throw std::runtime_error("Shader include failed.");
+        }
+
+        std::string included = readSource(shaderCode.substr(nameStart + 1, nameEnd - nameStart - 1).c_str());
+        expandIncludes(included, depth + 1);
+        shaderCode.replace(pos, lineEnd - pos, included);
+        pos += included.size();
+    }
+}
 
+std::string Shader::loadSource(const char* shaderFile, const std::string& defines)
+{
+    std::string shaderCode = readSource(shaderFile);
+    expandIncludes(shaderCode, 0);
+    injectDefines(shaderCode, defines);
+    return shaderCode;
+}
+
+std::unique_ptr<Shader> Shader::fromSource(GLenum shaderType, const std::string& shaderCode, bool checkErrors)
+{
+    std::unique_ptr<Shader> shader(new Shader());
+    shader->createShader(shaderType, shaderCode.c_str(), checkErrors);
+    return shader;
+}
+
+void Shader::createShaderFromFile(GLenum shaderType, const char* shaderFile, const std::string& defines)
+{
+    std::string shaderCode = loadSource(shaderFile, defines);
+    createShader(shaderType, shaderCode.c_str());
 }
 
 
@@ -48,6 +126,6 @@ void Shader::createShaderFromFile(GLenum shaderType, const char* shaderFile)
 void Shader::attachShader(GLuint program_id)
 {
     if (this->id != 0 && program_id != 0) {
-        glAttachShader(program_id, this->id);
+        RenderDevice::get().attachShader(program_id, this->id);
     }
 }
\ No newline at end of file
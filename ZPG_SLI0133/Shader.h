@@ -2,15 +2,29 @@
 #include <GL/glew.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string>
+#include <memory>
 
 class Shader
 {
 public:
-	Shader(GLenum shaderType, const char* shaderFile);
-	void createShaderFromFile(GLenum shaderType, const char* shaderFile);
-	void createShader(GLenum shaderType, const char* shaderCode);
+	// defines se vlozi hned za radek #version (permutace shaderu)
+	Shader(GLenum shaderType, const char* shaderFile, const std::string& defines = "");
+	~Shader();
+	Shader(const Shader&) = delete;
+	Shader& operator=(const Shader&) = delete;
+
+	void createShaderFromFile(GLenum shaderType, const char* shaderFile, const std::string& defines = "");
+	// checkErrors = false: glCompileShader se jen zada, stav se overi pozdeji (async preklad)
+	void createShader(GLenum shaderType, const char* shaderCode, bool checkErrors = true);
 	void attachShader(GLuint shader_id);
+
+	// Nacte zdrojak ze souboru, rozvine #include "soubor" a vlozi defines (bez prekladu)
+	static std::string loadSource(const char* shaderFile, const std::string& defines = "");
+	static std::unique_ptr<Shader> fromSource(GLenum shaderType, const std::string& shaderCode, bool checkErrors = true);
+
+	void checkCompileErrors();
 private:
+	Shader() : id(0) {}
 	GLuint id;
-	void checkCompileErrors();
 };
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "ShaderLibrary.h"
+#include "ShaderProgram.h"
+#include "Camera.h"
+
+ShaderLibrary& ShaderLibrary::get() {
+    static ShaderLibrary library;
+    return library;
+}
+
+void ShaderLibrary::initParallelCompile() {
+    if (GLEW_KHR_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu); // pocet vlaken necha na ovladaci
+        m_ParallelCompile = true;
+    }
+    else if (GLEW_ARB_parallel_shader_compile) {
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+        m_ParallelCompile = true;
+    }
+}
+
+std::shared_ptr<ShaderProgram> ShaderLibrary::getProgram(const std::string& vertexShaderFile,
+    const std::string& fragmentShaderFile, const std::string& defines) {
+    std::shared_ptr<ShaderProgram> program = findOrCreate(vertexShaderFile, fragmentShaderFile, defines, false);
+    // Mohl byt uz drive zadany asynchronne; ze seznamu cekajicich ho odebere poll()
+    program->finishLink();
+    return program;
+}
+
+std::shared_ptr<ShaderProgram> ShaderLibrary::requestProgram(const std::string& vertexShaderFile,
+    const std::string& fragmentShaderFile, const std::string& defines) {
+    return findOrCreate(vertexShaderFile, fragmentShaderFile, defines, true);
+}
+
+std::shared_ptr<ShaderProgram> ShaderLibrary::findOrCreate(const std::string& vertexShaderFile,
+    const std::string& fragmentShaderFile, const std::string& defines, bool async) {
+    std::string key = vertexShaderFile + '\n' + fragmentShaderFile + '\n' + defines;
+
+    auto it = m_Programs.find(key);
+    if (it != m_Programs.end()) {
+        return it->second;
+    }
+
+    auto program = std::make_shared<ShaderProgram>(vertexShaderFile, fragmentShaderFile, defines, async);
+    m_CompileCount++;
+
+    if (m_Camera) {
+        m_Camera->attach(program.get());
+        program->update(m_Camera);
+    }
+    if (async) {
+        // Stav se zjistuje az v poll(), aby se stihly zadat vsechny preklady najednou
+        m_Pending.push_back(program);
+    }
+
+    m_Programs[key] = program;
+    return program;
+}
+
+void ShaderLibrary::poll() {
+    for (size_t i = 0; i < m_Pending.size();) {
+        if (m_Pending[i]->isReady()) {
+            m_Pending[i] = m_Pending.back();
+            m_Pending.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+}
+
+void ShaderLibrary::bindCamera(Camera* camera) {
+    if (camera == m_Camera) return;
+
+    for (auto& entry : m_Programs) {
+        if (m_Camera) m_Camera->detach(entry.second.get());
+        if (camera) {
+            camera->attach(entry.second.get());
+            entry.second->update(camera);
+        }
+    }
+    m_Camera = camera;
+}
+
+void ShaderLibrary::unbindCamera(Camera* camera) {
+    if (camera && camera == m_Camera) {
+        bindCamera(nullptr);
+    }
+}
+
+void ShaderLibrary::clear() {
+    bindCamera(nullptr);
+    m_Pending.clear();
+    m_Programs.clear();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ShaderProgram;
+class Camera;
+
+// Registr slinkovanych programu pro cely proces, klic (vertex, fragment, defines).
+// Programy preziji prepnuti sceny; pozorovatele kamery se prevesi na kameru aktivni sceny.
+class ShaderLibrary {
+public:
+    static ShaderLibrary& get();
+
+    // Po vytvoreni GL kontextu: povoli paralelni preklad, pokud ho ovladac umi
+    void initParallelCompile();
+    bool hasParallelCompile() const { return m_ParallelCompile; }
+
+    // Vzdy vrati slinkovany program (pripadne na nej pocka)
+    std::shared_ptr<ShaderProgram> getProgram(const std::string& vertexShaderFile,
+        const std::string& fragmentShaderFile, const std::string& defines = "");
+    // Zada preklad a hned se vrati; program muze byt jeste nehotovy (isReady)
+    std::shared_ptr<ShaderProgram> requestProgram(const std::string& vertexShaderFile,
+        const std::string& fragmentShaderFile, const std::string& defines = "");
+
+    // Jednou za snimek: dokonci programy, jejichz preklad mezitim dobehl
+    void poll();
+    size_t getPendingCount() const { return m_Pending.size(); }
+
+    void bindCamera(Camera* camera);
+    // Volat pri niceni kamery (Scene::~Scene)
+    void unbindCamera(Camera* camera);
+
+    // Pred glfwTerminate, dokud existuje GL kontext
+    void clear();
+
+    size_t getProgramCount() const { return m_Programs.size(); }
+    size_t getCompileCount() const { return m_CompileCount; }
+
+private:
+    ShaderLibrary() = default;
+
+    std::shared_ptr<ShaderProgram> findOrCreate(const std::string& vertexShaderFile,
+        const std::string& fragmentShaderFile, const std::string& defines, bool async);
+
+    std::unordered_map<std::string, std::shared_ptr<ShaderProgram>> m_Programs;
+    std::vector<std::shared_ptr<ShaderProgram>> m_Pending;
+    Camera* m_Camera = nullptr;
+    size_t m_CompileCount = 0;
+    bool m_ParallelCompile = false;
+};
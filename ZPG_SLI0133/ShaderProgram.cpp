@@ -1,49 +1,120 @@
 #include "ShaderProgram.h"
 #include "Shader.h"
 #include "Camera.h"
-#include "Lights.h"
+#include "LightStorage.h"
 #include "Material.h"
+#include "ProgramBinaryCache.h"
+#include "RenderStats.h"
+#include "RenderDevice.h"
 #include <iostream>
-#include <glm/gtc/type_ptr.hpp>
 #include <stdexcept>
 #include <string>
 
-ShaderProgram::ShaderProgram(Shader& vs, Shader& fs) {
-    ID = glCreateProgram();
+ShaderProgram::ShaderProgram(Shader& vs, Shader& fs)
+    : m_Ready(true), m_CacheKey(0) {
+    ID = RenderDevice::get().createProgram();
     vs.attachShader(ID);
     fs.attachShader(ID);
-    glLinkProgram(ID);
+    RenderDevice::get().linkProgram(ID);
     checkLinkErrors();
+    bindSamplers();
+}
+
+ShaderProgram::ShaderProgram(const std::string& vertexShaderFile, const std::string& fragmentShaderFile, const std::string& defines, bool async)
+    : m_Ready(true), m_CacheKey(0) {
+    std::string vertexSource = Shader::loadSource(vertexShaderFile.c_str(), defines);
+    std::string fragmentSource = Shader::loadSource(fragmentShaderFile.c_str(), defines);
+    m_CacheKey = ProgramBinaryCache::computeKey(vertexSource, fragmentSource);
+
+    RenderDevice& device = RenderDevice::get();
+    ID = device.createProgram();
+    if (ProgramBinaryCache::load(ID, m_CacheKey)) {
+        bindSamplers();
+        return;
+    }
+
+    // Odmitnuta binarka muze nechat program v chybovem stavu, zacneme znovu
+    device.deleteProgram(ID);
+    ID = device.createProgram();
+
+    // Shadery se jen zadaji; stav prekladu i linku se cte az ve finishLink()
+    vs = Shader::fromSource(GL_VERTEX_SHADER, vertexSource, false);
+    fs = Shader::fromSource(GL_FRAGMENT_SHADER, fragmentSource, false);
+    vs->attachShader(ID);
+    fs->attachShader(ID);
+
+    if (ProgramBinaryCache::isSupported()) {
+        device.programParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    device.linkProgram(ID);
+    m_Ready = false;
+
+    if (!async) {
+        finishLink();
+    }
+}
+
+bool ShaderProgram::isReady() {
+    if (m_Ready) return true;
+
+    // Bez KHR_parallel_shader_compile nejde zjistit stav bez cekani, dokoncime hned
+    RenderDevice& device = RenderDevice::get();
+    if (device.isNull() || GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile) {
+        if (!device.getProgrami(ID, GL_COMPLETION_STATUS_KHR)) return false;
+    }
+
+    finishLink();
+    return true;
+}
+
+void ShaderProgram::finishLink() {
+    if (m_Ready) return;
 
+    vs->checkCompileErrors();
+    fs->checkCompileErrors();
+    checkLinkErrors();
+
+    ProgramBinaryCache::store(ID, m_CacheKey);
+    vs.reset();
+    fs.reset();
+
+    bindSamplers();
+    m_Ready = true;
+}
+
+void ShaderProgram::bindSamplers() {
+    // Hodnoty uniformu se po linku i po glProgramBinary nastavuji znovu
+    RenderDevice& device = RenderDevice::get();
     use();
     setInt("u_DiffuseTexture", 0); // Nastavme sampler u_DiffuseTexture na GL_TEXTURE0
-    glUseProgram(0);
-
+    // Vazba bloku se neda spolehat na vychozi 0, nastavi se jako samplery
+    GLuint lightBlock = device.getUniformBlockIndex(ID, "LightBlock");
+    if (lightBlock != GL_INVALID_INDEX) {
+        device.uniformBlockBinding(ID, lightBlock, LightStorage::BLOCK_BINDING);
+    }
+    device.useProgram(0);
 }
 
 ShaderProgram::~ShaderProgram() {
     if (ID != 0) {
-        glDeleteProgram(ID);
+        RenderDevice::get().deleteProgram(ID);
     }
 } 
 
 void ShaderProgram::use() const {
-    glUseProgram(ID);
+    RenderDevice::get().useProgram(ID);
+    RenderStats::get().countProgramBind();
 }
 
 void ShaderProgram::checkLinkErrors() {
-    GLint success;
-    glGetProgramiv(ID, GL_LINK_STATUS, &success);
-    if (!success) {
-        char infoLog[512];
-        glGetProgramInfoLog(ID, 512, NULL, infoLog);
-        std::cerr << "SHADER_PROGRAM_LINKING_ERROR:\n" << infoLog << std::endl;
+    if (!RenderDevice::get().getProgrami(ID, GL_LINK_STATUS)) {
+        std::cerr << "SHADER_PROGRAM_LINKING_ERROR:\n" << RenderDevice::get().getProgramInfoLog(ID) << std::endl;
         throw std::runtime_error("Shader program linking failed.");
     }
 }
 
-GLint ShaderProgram::getUniformLocation(const std::string& name) const {
-    GLint location = glGetUniformLocation(ID, name.c_str());
+GLint ShaderProgram::getUniformLocation(const char* name) const {
+    GLint location = RenderDevice::get().getUniformLocation(ID, name);
     return location;
 }
 
@@ -54,96 +125,45 @@ void ShaderProgram::update(Camera* cam) {
     }
 }
 
-void ShaderProgram::setMat4(const std::string& name, const glm::mat4& mat) const {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(mat));
-}
-
-void ShaderProgram::setVec4(const std::string& name, const glm::vec4& vec) const {
-    glUniform4fv(getUniformLocation(name), 1, glm::value_ptr(vec));
+void ShaderProgram::setMat4(const char* name, const glm::mat4& mat) const {
+    RenderDevice::get().uniform(getUniformLocation(name), mat);
+    RenderStats::get().countUniform();
 }
 
-
-void ShaderProgram::setVec3(const std::string& name, const glm::vec3& vec) const {
-    glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(vec));
+void ShaderProgram::setMat3(const char* name, const glm::mat3& mat) const {
+    RenderDevice::get().uniform(getUniformLocation(name), mat);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setFloat(const std::string& name, float value) const {
-    glUniform1f(getUniformLocation(name), value);
+void ShaderProgram::setVec4(const char* name, const glm::vec4& vec) const {
+    RenderDevice::get().uniform(getUniformLocation(name), vec);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setInt(const std::string& name, int value) const {
-    glUniform1i(getUniformLocation(name), value);
+void ShaderProgram::setIVec4(const char* name, const glm::ivec4& vec) const {
+    RenderDevice::get().uniform(getUniformLocation(name), vec);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setBool(const std::string& name, bool value) const {
-    glUniform1i(getUniformLocation(name), (int)value);
-}
 
-void ShaderProgram::setAmbientLight(const glm::vec3& color) const {
-    setVec3("u_AmbientLight", color);
+void ShaderProgram::setVec3(const char* name, const glm::vec3& vec) const {
+    RenderDevice::get().uniform(getUniformLocation(name), vec);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setLights(const std::vector<std::unique_ptr<Light>>& lights) const {
-    int dirLightIndex = 0;
-    int pointLightIndex = 0;
-
-    for (const auto& light : lights) {
-        if (DirLight* dLight = dynamic_cast<DirLight*>(light.get())) {
-            if (dirLightIndex < MAX_DIR_LIGHTS) {
-                std::string base = "u_DirLights[" + std::to_string(dirLightIndex) + "].";
-                setVec3(base + "direction", dLight->direction);
-                setVec3(base + "color", dLight->color);
-                dirLightIndex++;
-            }
-        }
-        else if (PointLight* pLight = dynamic_cast<PointLight*>(light.get())) {
-            if (pointLightIndex < MAX_POINT_LIGHTS) {
-                std::string base = "u_PointLights[" + std::to_string(pointLightIndex) + "].";
-                setVec3(base + "position", pLight->position);
-                setVec3(base + "color", pLight->color);
-                setFloat(base + "constant", pLight->constant);
-                setFloat(base + "linear", pLight->linear);
-                setFloat(base + "quadratic", pLight->quadratic);
-                pointLightIndex++;
-            }
-        }
-    }
-
-    setInt("u_DirLightCount", dirLightIndex);
-    setInt("u_PointLightCount", pointLightIndex);
+void ShaderProgram::setFloat(const char* name, float value) const {
+    RenderDevice::get().uniform(getUniformLocation(name), value);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setFlashlight(const SpotLight& light, bool on) const {
-    setBool("u_FlashlightOn", on);
-    setVec3("u_Flashlight.position", light.position);
-    setVec3("u_Flashlight.direction", light.direction);
-    setVec3("u_Flashlight.color", light.color);
-    setFloat("u_Flashlight.constant", light.constant);
-    setFloat("u_Flashlight.linear", light.linear);
-    setFloat("u_Flashlight.quadratic", light.quadratic);
-    setFloat("u_Flashlight.cutOff", light.cutOff);
-    setFloat("u_Flashlight.outerCutOff", light.outerCutOff);
+void ShaderProgram::setInt(const char* name, int value) const {
+    RenderDevice::get().uniform(getUniformLocation(name), value);
+    RenderStats::get().countUniform();
 }
 
-void ShaderProgram::setSpotLights(const std::vector<std::unique_ptr<SpotLight>>& lights) const {
-    int lightCount = static_cast<int>(lights.size());
-    if (lightCount > MAX_SPOT_LIGHTS) {
-        lightCount = MAX_SPOT_LIGHTS;
-    }
-    setInt("u_SpotLightCount", lightCount);
-
-    for (int i = 0; i < lightCount; ++i) {
-        const auto& light = lights[i];
-        std::string base = "u_SpotLights[" + std::to_string(i) + "].";
-        setVec3(base + "position", light->position);
-        setVec3(base + "direction", light->direction);
-        setVec3(base + "color", light->color);
-        setFloat(base + "constant", light->constant);
-        setFloat(base + "linear", light->linear);
-        setFloat(base + "quadratic", light->quadratic);
-        setFloat(base + "cutOff", light->cutOff);
-        setFloat(base + "outerCutOff", light->outerCutOff);
-    }
+void ShaderProgram::setBool(const char* name, bool value) const {
+    RenderDevice::get().uniform(getUniformLocation(name), (int)value);
+    RenderStats::get().countUniform();
 }
 
 void ShaderProgram::setMaterial(const Material& mat) const {
@@ -3,13 +3,12 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
 #include <glm/glm.hpp>
 #include "ICameraObserver.h" 
 
 class Shader;
 class Camera;
-class Light;
-class SpotLight;
 struct Material;
 
 class ShaderProgram : public ICameraObserver {
@@ -17,36 +16,44 @@ private:
     GLuint ID;
     std::unique_ptr<Shader> vs, fs;
 
+    // Async preklad: program je slinkovany az po finishLink()
+    bool m_Ready;
+    uint64_t m_CacheKey;
+
     glm::mat4 cachedViewMatrix;
     glm::mat4 cachedProjectionMatrix;
 
 private:
     void checkLinkErrors();
-    GLint getUniformLocation(const std::string& name) const;
+    void bindSamplers();
+    GLint getUniformLocation(const char* name) const;
 
 public:
-    static const int MAX_DIR_LIGHTS = 2;
-    static const int MAX_POINT_LIGHTS = 8;
-    static const int MAX_SPOT_LIGHTS = 4;
-
     ShaderProgram(Shader& vs, Shader& fs);
+    // Prednostne nacita slinkovany program z ProgramBinaryCache, jinak preklada ze zdrojaku.
+    // async = true: preklad se jen zada, dokonceni hlida isReady()
+    ShaderProgram(const std::string& vertexShaderFile, const std::string& fragmentShaderFile,
+        const std::string& defines = "", bool async = false);
     ~ShaderProgram();
 
     void update(Camera* cam) override;
 
+    // Neblokujici dotaz (GL_COMPLETION_STATUS_KHR); hotovy program rovnou dokonci
+    bool isReady();
+    // Blokujici dokonceni prekladu a linku
+    void finishLink();
+
     void use() const;
 
-    void setMat4(const std::string& name, const glm::mat4& mat) const;
-    void setVec4(const std::string& name, const glm::vec4& vec) const;
-    void setVec3(const std::string& name, const glm::vec3& vec) const;
-    void setFloat(const std::string& name, float value) const;
-    void setInt(const std::string& name, int value) const;
-    void setBool(const std::string& name, bool value) const;
-
-    void setAmbientLight(const glm::vec3& color) const;
-    void setLights(const std::vector<std::unique_ptr<Light>>& lights) const;
-    void setFlashlight(const SpotLight& light, bool on) const;
-    void setSpotLights(const std::vector<std::unique_ptr<SpotLight>>& lights) const;
+    void setMat4(const char* name, const glm::mat4& mat) const;
+    void setMat3(const char* name, const glm::mat3& mat) const;
+    void setVec4(const char* name, const glm::vec4& vec) const;
+    void setIVec4(const char* name, const glm::ivec4& vec) const;
+    void setVec3(const char* name, const glm::vec3& vec) const;
+    void setFloat(const char* name, float value) const;
+    void setInt(const char* name, int value) const;
+    void setBool(const char* name, bool value) const;
+
     void setMaterial(const Material& mat) const;
 
     const glm::mat4& getViewMatrix() const { return cachedViewMatrix; }
@@ -0,0 +1,76 @@
+#include "ShaderVariantManager.h"
+#include "ShaderProgram.h"
+#include "ShaderLibrary.h"
+#include "Material.h"
+#include "LightStorage.h"
+
+uint8_t ShaderVariantKey::objectFeatures(const Material& material, bool unlit) {
+    uint8_t features = 0;
+    if (unlit) features |= SHADER_UNLIT;
+    if (material.diffuseTextureID != 0) features |= SHADER_TEXTURED;
+    return features;
+}
+
+ShaderVariantManager::ShaderVariantManager(const std::string& vertexShaderFile, const std::string& fragmentShaderFile)
+    : m_VertexShaderFile(vertexShaderFile),
+    m_FragmentShaderFile(fragmentShaderFile) {
+}
+
+ShaderVariantKey ShaderVariantManager::normalize(ShaderVariantKey key) {
+    if (key.features & SHADER_UNLIT) {
+        key.features &= ~SHADER_FLASHLIGHT;
+        key.dirLights = 0;
+        key.pointLights = 0;
+        key.spotLights = 0;
+    }
+    return key;
+}
+
+std::string ShaderVariantManager::buildDefines(const ShaderVariantKey& key) {
+    std::string defines;
+    if (key.features & SHADER_UNLIT) defines += "#define UNLIT\n";
+    if (key.features & SHADER_TEXTURED) defines += "#define HAS_DIFFUSE_TEXTURE\n";
+    if (key.features & SHADER_FLASHLIGHT) defines += "#define FLASHLIGHT\n";
+    defines += "#define NUM_DIR_LIGHTS " + std::to_string(key.dirLights) + "\n";
+    defines += "#define NUM_POINT_LIGHTS " + std::to_string(key.pointLights) + "\n";
+    defines += "#define NUM_SPOT_LIGHTS " + std::to_string(key.spotLights) + "\n";
+    defines += LightStorage::getBlockDefines();
+    return defines;
+}
+
+std::shared_ptr<ShaderProgram>& ShaderVariantManager::request(const ShaderVariantKey& normalized) {
+    // Lokalni mapa setri skladani textoveho klice knihovny pri kazdem bindu
+    std::shared_ptr<ShaderProgram>& program = m_Variants[normalized.packed()];
+    if (!program) {
+        program = ShaderLibrary::get().requestProgram(m_VertexShaderFile, m_FragmentShaderFile, buildDefines(normalized));
+    }
+    return program;
+}
+
+ShaderVariantKey ShaderVariantManager::fallbackKey(const ShaderVariantKey& normalized) {
+    ShaderVariantKey fallback;
+    fallback.features = SHADER_UNLIT | (normalized.features & SHADER_TEXTURED);
+    return fallback;
+}
+
+ShaderProgram& ShaderVariantManager::getFallback(const ShaderVariantKey& normalized) {
+    std::shared_ptr<ShaderProgram>& program = request(fallbackKey(normalized));
+    // Zaskok musi byt k dispozici hned, na ten se pocka
+    program->finishLink();
+    return *program;
+}
+
+ShaderProgram& ShaderVariantManager::get(const ShaderVariantKey& key) {
+    ShaderVariantKey normalized = normalize(key);
+    std::shared_ptr<ShaderProgram>& program = request(normalized);
+    if (program->isReady()) {
+        return *program;
+    }
+    return getFallback(normalized);
+}
+
+void ShaderVariantManager::prewarm(const ShaderVariantKey& key) {
+    ShaderVariantKey normalized = normalize(key);
+    request(normalized);
+    request(fallbackKey(normalized));
+}
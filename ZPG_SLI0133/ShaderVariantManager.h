@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+class ShaderProgram;
+struct Material;
+
+enum ShaderFeature : uint8_t {
+    SHADER_UNLIT = 1 << 0,
+    SHADER_TEXTURED = 1 << 1,
+    SHADER_FLASHLIGHT = 1 << 2,
+};
+
+// Klic permutace: zapnute vlastnosti + pocty svetel zakompilovane do shaderu
+struct ShaderVariantKey {
+    uint8_t features = 0;
+    uint8_t dirLights = 0;
+    uint8_t pointLights = 0;
+    uint8_t spotLights = 0;
+
+    uint32_t packed() const {
+        return (uint32_t)features | ((uint32_t)dirLights << 8) | ((uint32_t)pointLights << 16) | ((uint32_t)spotLights << 24);
+    }
+    // 16 bitu pro radici klic vykreslovani (pocty svetel musi byt < 16)
+    uint16_t compact() const {
+        return (uint16_t)((features & 0xF) | (dirLights << 4) | (pointLights << 8) | (spotLights << 12));
+    }
+    static ShaderVariantKey fromCompact(uint16_t compact) {
+        ShaderVariantKey key;
+        key.features = (uint8_t)(compact & 0xF);
+        key.dirLights = (uint8_t)((compact >> 4) & 0xF);
+        key.pointLights = (uint8_t)((compact >> 8) & 0xF);
+        key.spotLights = (uint8_t)((compact >> 12) & 0xF);
+        return key;
+    }
+    bool operator==(const ShaderVariantKey& other) const { return packed() == other.packed(); }
+    bool operator!=(const ShaderVariantKey& other) const { return packed() != other.packed(); }
+
+    // Vlastnosti dane objektem (material, priznaky ve storage)
+    static uint8_t objectFeatures(const Material& material, bool unlit);
+};
+
+// Varianty jednoho paru vert/frag; programy drzi ShaderLibrary, kazda varianta
+// se preklada asynchronne pri prvnim pouziti (nebo prewarm) a pak se sdili mezi scenami
+class ShaderVariantManager {
+public:
+    ShaderVariantManager(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
+
+    // Unlit varianty nepotrebuji svetla, klic se normalizuje, aby se zbytecne nenasobily
+    static ShaderVariantKey normalize(ShaderVariantKey key);
+    static std::string buildDefines(const ShaderVariantKey& key);
+
+    // Dokud neni varianta prelozena, vrati levny unlit zaskok
+    ShaderProgram& get(const ShaderVariantKey& key);
+    // Zada preklad dopredu (po nacteni sceny)
+    void prewarm(const ShaderVariantKey& key);
+    size_t getVariantCount() const { return m_Variants.size(); }
+
+private:
+    std::shared_ptr<ShaderProgram>& request(const ShaderVariantKey& normalized);
+    static ShaderVariantKey fallbackKey(const ShaderVariantKey& normalized);
+    ShaderProgram& getFallback(const ShaderVariantKey& normalized);
+
+    std::string m_VertexShaderFile;
+    std::string m_FragmentShaderFile;
+    std::unordered_map<uint32_t, std::shared_ptr<ShaderProgram>> m_Variants;
+};
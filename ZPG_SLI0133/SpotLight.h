@@ -1,20 +1,21 @@
 #pragma once
-#include "Light.h"
+#include <glm/glm.hpp>
 
-class SpotLight : public Light {
-public:
+// std140 rozlozeni: skalary vyplnuji ctvrtou slozku predchoziho vec3
+struct SpotLight {
     glm::vec3 position;
-    glm::vec3 direction;
     float constant;
+    glm::vec3 direction;
     float linear;
+    glm::vec3 color;
     float quadratic;
     float cutOff;
     float outerCutOff;
+    float _pad[2];
 
     SpotLight(const glm::vec3& pos, const glm::vec3& dir, const glm::vec3& col,
         float con, float lin, float quad, float cut, float outerCut)
-        : Light(col), position(pos), direction(dir),
-        constant(con), linear(lin), quadratic(quad),
-        cutOff(cut), outerCutOff(outerCut) {
+        : position(pos), constant(con), direction(dir), linear(lin),
+        color(col), quadratic(quad), cutOff(cut), outerCutOff(outerCut), _pad{ 0.0f, 0.0f } {
     }
 };
\ No newline at end of file
@@ -1,8 +1,12 @@
 #include "TextureLoader.h"
 #include <iostream>
 #include "stb_image.h" 
+#include "Profiler.h"
+#include "RenderStats.h"
+#include "RenderDevice.h"
 
 GLuint TextureLoader::LoadTexture(const std::string& path, bool flip) {
+    ZPG_PROFILE_SCOPE("TextureLoader::LoadTexture");
     stbi_set_flip_vertically_on_load(flip);
 
     int width, height, channels;
@@ -27,20 +31,24 @@ GLuint TextureLoader::LoadTexture(const std::string& path, bool flip) {
         return 0;
     }
 
-    GLuint textureID;
-    glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    RenderDevice& device = RenderDevice::get();
+    GLuint textureID = device.genTexture();
+    device.bindTexture(GL_TEXTURE_2D, textureID);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-    glGenerateMipmap(GL_TEXTURE_2D);
+    device.texImage2D(GL_TEXTURE_2D, 0, format, width, height, format, GL_UNSIGNED_BYTE, data);
+    device.generateMipmap(GL_TEXTURE_2D);
+    // Mipmapy pridaji asi tretinu
+    const int64_t bytes = (int64_t)width * height * channels;
+    RenderStats::get().countUpload((size_t)bytes);
+    RenderStats::get().addTextureMemory(bytes + bytes / 3);
 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    device.texParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     stbi_image_free(data);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    device.bindTexture(GL_TEXTURE_2D, 0);
 
     std::cout << "Textura nahrana: " << path << " (ID: " << textureID << ")" << std::endl;
     return textureID;
@@ -48,9 +56,10 @@ GLuint TextureLoader::LoadTexture(const std::string& path, bool flip) {
 
 GLuint TextureLoader::loadCubemap(std::vector<std::string> faces)
 {
-    GLuint textureID;
-    glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, textureID);
+    ZPG_PROFILE_SCOPE("TextureLoader::loadCubemap");
+    RenderDevice& device = RenderDevice::get();
+    GLuint textureID = device.genTexture();
+    device.bindTexture(GL_TEXTURE_CUBE_MAP, textureID);
 
     int width, height, nrChannels;
     stbi_set_flip_vertically_on_load(false);
@@ -63,9 +72,12 @@ GLuint TextureLoader::loadCubemap(std::vector<std::string> faces)
             if (nrChannels == 4)
                 format = GL_RGBA;
 
-            glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
-                0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data
+            device.texImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i,
+                0, format, width, height, format, GL_UNSIGNED_BYTE, data
             );
+            const int64_t bytes = (int64_t)width * height * nrChannels;
+            RenderStats::get().countUpload((size_t)bytes);
+            RenderStats::get().addTextureMemory(bytes);
             stbi_image_free(data);
         }
         else
@@ -74,11 +86,11 @@ GLuint TextureLoader::loadCubemap(std::vector<std::string> faces)
             stbi_image_free(data);
         }
     }
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+    device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    device.texParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 
     stbi_set_flip_vertically_on_load(true);
 
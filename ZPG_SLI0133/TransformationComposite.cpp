@@ -1,20 +1,28 @@
 #include "TransformationComposite.h"
-#include "TransformationComponent.h"
-#include "TransformationLeafs.h"
 
 #include <glm/gtc/matrix_transform.hpp> 
 #include <glm/gtc/type_ptr.hpp>
 
-TransformationComposite::TransformationComposite() {
-}
+const int TransformationComposite::MAX_STEPS;
 
-TransformationComposite::~TransformationComposite() {
+glm::mat4 TransformStep::apply(const glm::mat4& matrix) const {
+    switch (type) {
+    case ROTATE: return glm::rotate(matrix, angle, vector);
+    case TRANSLATE: return glm::translate(matrix, vector);
+    case SCALE: return glm::scale(matrix, vector);
+    default: {
+        // ZADANI: ve ctvrtem radku a ctvrtem sloupci misto jednicky hodnota 20
+        glm::mat4 m(1.0f);
+        m[3][3] = 20.0f;
+        return matrix * m;
+    }
+    }
 }
 
 glm::mat4 TransformationComposite::calculateMatrix() const {
-    glm::mat4 currentMatrix(1.0f);
-    for (const auto& component : components) {
-        currentMatrix = component->apply(currentMatrix);
+    glm::mat4 currentMatrix = m_Baked;
+    for (int i = 0; i < m_Count; ++i) {
+        currentMatrix = m_Steps[i].apply(currentMatrix);
     }
     return currentMatrix;
 }
@@ -24,27 +32,34 @@ glm::mat4 TransformationComposite::getMatrix() const {
 }
 
 void TransformationComposite::reset() {
-    components.clear();
+    m_Count = 0;
+    m_Baked = glm::mat4(1.0f);
 }
 
+TransformationComposite& TransformationComposite::add(TransformStep::Type type, float angle, const glm::vec3& vector) {
+    if (m_Count == MAX_STEPS) {
+        m_Baked = calculateMatrix();
+        m_Count = 0;
+    }
+    TransformStep& step = m_Steps[m_Count++];
+    step.type = type;
+    step.angle = angle;
+    step.vector = vector;
+    return *this;
+}
 
 TransformationComposite& TransformationComposite::rotate(float angle, const glm::vec3& axis) {
-    components.push_back(std::make_unique<RotationTransformation>(angle, axis));
-    return *this;
+    return add(TransformStep::ROTATE, angle, axis);
 }
 
 TransformationComposite& TransformationComposite::translate(const glm::vec3& translation) {
-    components.push_back(std::make_unique<TranslationTransformation>(translation));
-    return *this;
+    return add(TransformStep::TRANSLATE, 0.0f, translation);
 }
 
 TransformationComposite& TransformationComposite::scale(const glm::vec3& scaleVector) {
-    components.push_back(std::make_unique<ScaleTransformation>(scaleVector));
-    return *this;
+    return add(TransformStep::SCALE, 0.0f, scaleVector);
 }
-// Pidejte do TransformationComposite.cpp
+
 TransformationComposite& TransformationComposite::addMatrix20() {
-    // Pidme nai speciln transformaci do seznamu
-    components.push_back(std::make_unique<Matrix20Transformation>());
-    return *this;
+    return add(TransformStep::MATRIX20, 0.0f, glm::vec3(0.0f));
 }
\ No newline at end of file
@@ -1,19 +1,33 @@
 #pragma once
 #include <glm/glm.hpp>
-#include <vector>
-#include <memory>
+#include <cstdint>
 
-class TransformationComponent; 
+// Jeden krok transformace jako hodnota; nic nealokuje, objekt ho drzi primo
+// v poli ObjectStorage
+struct TransformStep {
+    enum Type : uint8_t { ROTATE, TRANSLATE, SCALE, MATRIX20 };
+
+    Type type;
+    float angle;
+    glm::vec3 vector;
+
+    glm::mat4 apply(const glm::mat4& matrix) const;
+};
 
 class TransformationComposite {
+public:
+    // Vic kroku nez MAX_STEPS se slozi do jedne matice (vysledek je stejny)
+    static const int MAX_STEPS = 8;
+
 private:
-    std::vector<std::unique_ptr<TransformationComponent>> components;
+    TransformStep m_Steps[MAX_STEPS];
+    int m_Count = 0;
+    glm::mat4 m_Baked = glm::mat4(1.0f);
+
     glm::mat4 calculateMatrix() const;
+    TransformationComposite& add(TransformStep::Type type, float angle, const glm::vec3& vector);
 
 public:
-    TransformationComposite();
-    ~TransformationComposite();
-
     glm::mat4 getMatrix() const;
     void reset();
 
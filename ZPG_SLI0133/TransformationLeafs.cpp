@@ -1,36 +0,0 @@
-#include "TransformationLeafs.h"
-#include <glm/gtc/matrix_transform.hpp> 
-
-RotationTransformation::RotationTransformation(float angle, const glm::vec3& axis)
-    : angle(angle), axis(axis) {
-}
-
-glm::mat4 RotationTransformation::apply(const glm::mat4& matrix) const {
-    return glm::rotate(matrix, angle, axis);
-}
-
-TranslationTransformation::TranslationTransformation(const glm::vec3& translation)
-    : translationVector(translation) {
-}
-
-glm::mat4 TranslationTransformation::apply(const glm::mat4& matrix) const {
-    return glm::translate(matrix, translationVector);
-}
-
-ScaleTransformation::ScaleTransformation(const glm::vec3& scaleVector)
-    : scaleVector(scaleVector) {
-}
-
-glm::mat4 ScaleTransformation::apply(const glm::mat4& matrix) const {
-    return glm::scale(matrix, scaleVector);
-
-
-}
-glm::mat4 Matrix20Transformation::apply(const glm::mat4& matrix) const {
-    glm::mat4 m(1.0f); // Vytvo jednotkovou matici
-
-    // ZADN: "ve tvrtm dku a tvrtm sloupci vlote msto jedniky hodnotu 20"
-    m[3][3] = 20.0f;
-
-    return matrix * m;
-}
@@ -1,4 +1,28 @@
 #version 330 core
+// Permutace skladane ShaderVariantManagerem:
+// UNLIT, HAS_DIFFUSE_TEXTURE, FLASHLIGHT, NUM_DIR_LIGHTS, NUM_POINT_LIGHTS, NUM_SPOT_LIGHTS
+// MAX_*_LIGHTS dava LightStorage::getBlockDefines()
+// NUM_POINT_LIGHTS = pocet slotu na objekt (0 nebo MAX_OBJECT_LIGHTS), obsazenych je
+// u_ObjectLightCount, indexy svetel vybira LightGrid
+#ifndef NUM_DIR_LIGHTS
+#define NUM_DIR_LIGHTS 0
+#endif
+#ifndef NUM_POINT_LIGHTS
+#define NUM_POINT_LIGHTS 0
+#endif
+#ifndef NUM_SPOT_LIGHTS
+#define NUM_SPOT_LIGHTS 0
+#endif
+#ifndef MAX_DIR_LIGHTS
+#define MAX_DIR_LIGHTS 2
+#endif
+#ifndef MAX_POINT_LIGHTS
+#define MAX_POINT_LIGHTS 8
+#endif
+#ifndef MAX_SPOT_LIGHTS
+#define MAX_SPOT_LIGHTS 4
+#endif
+
 out vec4 FragColor;
 
 in vec3 Normal;    
@@ -15,11 +39,11 @@ struct Material {
 }; 
 uniform Material u_Material;
 
-uniform bool u_IsUnlit; 
-
+#ifdef HAS_DIFFUSE_TEXTURE
 uniform sampler2D u_DiffuseTexture;
-uniform bool u_HasDiffuseTexture;
+#endif
 
+// std140 rozlozeni, musi odpovidat DirLight/PointLight/SpotLight/LightBlock v C++
 struct DirLight {
     vec3 direction;
     vec3 color;
@@ -27,39 +51,35 @@ struct DirLight {
 
 struct PointLight {
     vec3 position;
-    vec3 color;
     float constant;
+    vec3 color;
     float linear;
     float quadratic;
 };
 
 struct SpotLight {
     vec3 position;
-    vec3 direction;
-    vec3 color;
     float constant;
+    vec3 direction;
     float linear;
+    vec3 color;
     float quadratic;
     float cutOff;
     float outerCutOff;
 };
 
-uniform vec3 u_AmbientLight;
-
-const int MAX_DIR_LIGHTS = 2;
-uniform DirLight u_DirLights[MAX_DIR_LIGHTS];
-uniform int u_DirLightCount;
-
-const int MAX_POINT_LIGHTS = 8;
-uniform PointLight u_PointLights[MAX_POINT_LIGHTS];
-uniform int u_PointLightCount;
-
-const int MAX_SPOT_LIGHTS = 4;
-uniform SpotLight u_SpotLights[MAX_SPOT_LIGHTS];
-uniform int u_SpotLightCount;
+layout(std140) uniform LightBlock {
+    vec4 u_AmbientLight;
+    SpotLight u_Flashlight;
+    DirLight u_DirLights[MAX_DIR_LIGHTS];
+    PointLight u_PointLights[MAX_POINT_LIGHTS];
+    SpotLight u_SpotLights[MAX_SPOT_LIGHTS];
+};
 
-uniform SpotLight u_Flashlight;
-uniform bool u_FlashlightOn;
+#if NUM_POINT_LIGHTS > 0
+uniform ivec4 u_LightIndices;
+uniform int u_ObjectLightCount;
+#endif
 
 vec4 CalculateLightBase(vec3 lightColor, vec3 lightDir, vec3 norm, vec3 viewDir, vec3 albedo) {
     float diff_intensity = max(dot(norm, lightDir), 0.0);
@@ -107,32 +127,37 @@ vec4 CalculateSpotLight(SpotLight light, vec3 norm, vec3 fragPos, vec3 viewDir,
 
 void main() {
     vec3 albedo = u_Material.diffuse;
-    if (u_HasDiffuseTexture) {
-        albedo *= texture(u_DiffuseTexture, TexCoords).rgb;
-    }
-
-    if (u_IsUnlit) {
-        FragColor = vec4(albedo, 1.0);
-        return;
-    }
+#ifdef HAS_DIFFUSE_TEXTURE
+    albedo *= texture(u_DiffuseTexture, TexCoords).rgb;
+#endif
 
+#ifdef UNLIT
+    FragColor = vec4(albedo, 1.0);
+#else
     vec3 norm = normalize(Normal);
     vec3 viewDir = normalize(u_ViewPos - FragPos);
 
-    vec4 result = vec4(u_AmbientLight * u_Material.ambient * albedo, 1.0);
-    
-    for (int i = 0; i < u_DirLightCount; i++) {
+    vec4 result = vec4(u_AmbientLight.rgb * u_Material.ambient * albedo, 1.0);
+
+#if NUM_DIR_LIGHTS > 0
+    for (int i = 0; i < NUM_DIR_LIGHTS; i++) {
         result += CalculateDirLight(u_DirLights[i], norm, viewDir, albedo);
     }
-    for (int i = 0; i < u_PointLightCount; i++) {
-        result += CalculatePointLight(u_PointLights[i], norm, FragPos, viewDir, albedo);
+#endif
+#if NUM_POINT_LIGHTS > 0
+    for (int i = 0; i < u_ObjectLightCount; i++) {
+        result += CalculatePointLight(u_PointLights[u_LightIndices[i]], norm, FragPos, viewDir, albedo);
     }
-    for (int i = 0; i < u_SpotLightCount; i++) {
+#endif
+#if NUM_SPOT_LIGHTS > 0
+    for (int i = 0; i < NUM_SPOT_LIGHTS; i++) {
         result += CalculateSpotLight(u_SpotLights[i], norm, FragPos, viewDir, albedo);
     }
-    if (u_FlashlightOn) {
-        result += CalculateSpotLight(u_Flashlight, norm, FragPos, viewDir, albedo);
-    }
+#endif
+#ifdef FLASHLIGHT
+    result += CalculateSpotLight(u_Flashlight, norm, FragPos, viewDir, albedo);
+#endif
 
     FragColor = result;
+#endif
 }
\ No newline at end of file
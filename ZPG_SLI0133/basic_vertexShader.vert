@@ -8,12 +8,16 @@ out vec3 FragPos;
 out vec2 TexCoords;
 
 uniform mat4 u_ModelMatrix;
+uniform mat3 u_NormalMatrix; // pocita CPU jednou na objekt (ObjectStorage)
 uniform mat4 u_ViewMatrix;
 uniform mat4 u_ProjectionMatrix;
 
+// Stejny vypocet jako depth_prepass.vert, aby prosel GL_EQUAL test
+invariant gl_Position;
+
 void main() {
     FragPos = vec3(u_ModelMatrix * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(u_ModelMatrix))) * aNormal;
+    Normal = u_NormalMatrix * aNormal;
     TexCoords = aTexCoords;
     gl_Position = u_ProjectionMatrix * u_ViewMatrix * u_ModelMatrix * vec4(aPos, 1.0);
 }
\ No newline at end of file
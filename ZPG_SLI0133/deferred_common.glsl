@@ -0,0 +1,102 @@
+// Spolecny kod deferred osvetlovacich pruchodu (deferred_lighting.frag,
+// deferred_pointlight.frag): cteni G-bufferu, Blinn-Phong a LightBlock.
+// Vklada ho Shader::loadSource misto radku #include "deferred_common.glsl".
+#ifndef MAX_DIR_LIGHTS
+#define MAX_DIR_LIGHTS 2
+#endif
+#ifndef MAX_POINT_LIGHTS
+#define MAX_POINT_LIGHTS 8
+#endif
+#ifndef MAX_SPOT_LIGHTS
+#define MAX_SPOT_LIGHTS 4
+#endif
+
+uniform sampler2D u_GAlbedo;
+uniform sampler2D u_GNormalSpecular;
+uniform sampler2D u_GDepth;
+uniform mat4 u_InverseViewProjection;
+uniform vec4 u_Viewport; // x, y, sirka, vyska; G-buffer muze byt vetsi
+uniform vec3 u_ViewPos;
+
+struct GSample {
+    vec3 albedo;
+    float ambient;
+    vec3 normal;
+    float shininess;
+    float specular;
+    vec3 position;
+};
+
+vec3 decodeNormal(vec2 f) {
+    vec3 n = vec3(f.x, f.y, 1.0 - abs(f.x) - abs(f.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+GSample readGBuffer() {
+    ivec2 texel = ivec2(gl_FragCoord.xy);
+    vec4 albedo = texelFetch(u_GAlbedo, texel, 0);
+    vec4 normalSpecular = texelFetch(u_GNormalSpecular, texel, 0);
+    float depth = texelFetch(u_GDepth, texel, 0).r;
+    // Bez geometrie (vycistena hloubka) se neosvetluje, tam kresli skybox
+    if (depth >= 1.0) discard;
+
+    // Pozice ze hloubky pres inverzni view-projection
+    vec2 uv = (gl_FragCoord.xy - u_Viewport.xy) / u_Viewport.zw;
+    vec4 world = u_InverseViewProjection * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+
+    GSample s;
+    s.albedo = albedo.rgb;
+    s.ambient = albedo.a;
+    s.normal = decodeNormal(normalSpecular.xy);
+    s.shininess = normalSpecular.z;
+    s.specular = normalSpecular.w;
+    s.position = world.xyz / world.w;
+    return s;
+}
+
+vec3 CalculateLightBase(vec3 lightColor, vec3 lightDir, vec3 viewDir, GSample s) {
+    float diff_intensity = max(dot(s.normal, lightDir), 0.0);
+    vec3 diffuse = lightColor * diff_intensity * s.albedo;
+
+    vec3 halfDir = normalize(lightDir + viewDir);
+    float spec_intensity = pow(max(dot(s.normal, halfDir), 0.0), s.shininess);
+    vec3 specular = lightColor * spec_intensity * s.specular;
+
+    return diffuse + specular;
+}
+
+// std140 rozlozeni, musi odpovidat DirLight/PointLight/SpotLight/LightBlock v C++
+struct DirLight {
+    vec3 direction;
+    vec3 color;
+};
+
+struct PointLight {
+    vec3 position;
+    float constant;
+    vec3 color;
+    float linear;
+    float quadratic;
+};
+
+struct SpotLight {
+    vec3 position;
+    float constant;
+    vec3 direction;
+    float linear;
+    vec3 color;
+    float quadratic;
+    float cutOff;
+    float outerCutOff;
+};
+
+layout(std140) uniform LightBlock {
+    vec4 u_AmbientLight;
+    SpotLight u_Flashlight;
+    DirLight u_DirLights[MAX_DIR_LIGHTS];
+    PointLight u_PointLights[MAX_POINT_LIGHTS];
+    SpotLight u_SpotLights[MAX_SPOT_LIGHTS];
+};
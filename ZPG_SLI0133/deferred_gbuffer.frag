@@ -0,0 +1,48 @@
+#version 330 core
+// Geometry pass deferred shadingu. Permutace: UNLIT, HAS_DIFFUSE_TEXTURE
+layout (location = 0) out vec4 o_Albedo;          // rgb albedo, a ambient materialu
+layout (location = 1) out vec4 o_NormalSpecular;  // xy oct normala, z shininess (< 0 = unlit), w specular
+
+in vec3 Normal;
+in vec3 FragPos;
+in vec2 TexCoords;
+
+struct Material {
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+    float shininess;
+};
+uniform Material u_Material;
+
+#ifdef HAS_DIFFUSE_TEXTURE
+uniform sampler2D u_DiffuseTexture;
+#endif
+
+vec2 signNotZero(vec2 v) {
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+// Octahedral kodovani normaly do dvou slozek
+vec2 encodeNormal(vec3 n) {
+    n /= (abs(n.x) + abs(n.y) + abs(n.z));
+    return n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * signNotZero(n.xy);
+}
+
+void main() {
+    vec3 albedo = u_Material.diffuse;
+#ifdef HAS_DIFFUSE_TEXTURE
+    albedo *= texture(u_DiffuseTexture, TexCoords).rgb;
+#endif
+
+#ifdef UNLIT
+    o_Albedo = vec4(albedo, 1.0);
+    o_NormalSpecular = vec4(0.0, 0.0, -1.0, 0.0);
+#else
+    // Ambient a specular materialu se v G-bufferu drzi jako skalar
+    float ambient = max(u_Material.ambient.r, max(u_Material.ambient.g, u_Material.ambient.b));
+    float specular = max(u_Material.specular.r, max(u_Material.specular.g, u_Material.specular.b));
+    o_Albedo = vec4(albedo, ambient);
+    o_NormalSpecular = vec4(encodeNormal(normalize(Normal)), u_Material.shininess, specular);
+#endif
+}
\ No newline at end of file
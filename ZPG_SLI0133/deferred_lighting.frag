@@ -0,0 +1,59 @@
+#version 330 core
+// Fullscreen cast deferred osvetleni: ambient, smerova, reflektory a baterka.
+// Bodova svetla kresli DeferredRenderer jako objemy (deferred_pointlight.frag).
+#ifndef NUM_DIR_LIGHTS
+#define NUM_DIR_LIGHTS 0
+#endif
+#ifndef NUM_SPOT_LIGHTS
+#define NUM_SPOT_LIGHTS 0
+#endif
+
+out vec4 FragColor;
+
+#include "deferred_common.glsl"
+
+vec3 CalculateSpotLight(SpotLight light, vec3 viewDir, GSample s) {
+    vec3 lightDir = normalize(light.position - s.position);
+
+    float theta = dot(lightDir, normalize(-light.direction));
+    float epsilon = light.cutOff - light.outerCutOff;
+    float intensity = clamp((theta - light.outerCutOff) / epsilon, 0.0, 1.0);
+
+    if (intensity > 0.0) {
+        vec3 result = CalculateLightBase(light.color, lightDir, viewDir, s);
+
+        float distance = length(light.position - s.position);
+        float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+
+        return result * attenuation * intensity;
+    }
+    return vec3(0.0);
+}
+
+void main() {
+    GSample s = readGBuffer();
+
+    if (s.shininess < 0.0) {
+        FragColor = vec4(s.albedo, 1.0);
+        return;
+    }
+
+    vec3 viewDir = normalize(u_ViewPos - s.position);
+    vec3 result = u_AmbientLight.rgb * s.ambient * s.albedo;
+
+#if NUM_DIR_LIGHTS > 0
+    for (int i = 0; i < NUM_DIR_LIGHTS; i++) {
+        result += CalculateLightBase(u_DirLights[i].color, normalize(-u_DirLights[i].direction), viewDir, s);
+    }
+#endif
+#if NUM_SPOT_LIGHTS > 0
+    for (int i = 0; i < NUM_SPOT_LIGHTS; i++) {
+        result += CalculateSpotLight(u_SpotLights[i], viewDir, s);
+    }
+#endif
+#ifdef FLASHLIGHT
+    result += CalculateSpotLight(u_Flashlight, viewDir, s);
+#endif
+
+    FragColor = vec4(result, 1.0);
+}
\ No newline at end of file
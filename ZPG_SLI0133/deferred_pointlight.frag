@@ -0,0 +1,22 @@
+#version 330 core
+// Jedno bodove svetlo kreslene jako koule o polomeru jeho dosahu, aditivne
+out vec4 FragColor;
+
+#include "deferred_common.glsl"
+
+// Index svetla v u_PointLights
+uniform int u_PointLightIndex;
+
+void main() {
+    GSample s = readGBuffer();
+    if (s.shininess < 0.0) discard;
+
+    PointLight light = u_PointLights[u_PointLightIndex];
+    vec3 toLight = light.position - s.position;
+    float distance = length(toLight);
+    vec3 lightDir = toLight / distance;
+    vec3 viewDir = normalize(u_ViewPos - s.position);
+
+    float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+    FragColor = vec4(CalculateLightBase(light.color, lightDir, viewDir, s) * attenuation, 1.0);
+}
\ No newline at end of file
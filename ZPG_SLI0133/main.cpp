@@ -2,10 +2,93 @@
 #include <glm/glm.hpp>
 #include <iostream> 
 #include <vector> 
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
 
-int main() {
+static void printUsage() {
+    std::cout << "Usage: ZPG_SLI0133 [--headless] [--scene N] [--frames N] [--duration SECONDS] [--frame-log FILE]\n"
+        << "                   [--record FILE | --replay FILE] [--seed N] [--warmup N] [--trace FILE] [--gpu-draw-zones]\n"
+        << "                   [--stats-interval SECONDS] [--metrics FILE] [--dynamic-res GPU_MS] [--min-scale F]\n"
+        << "                   [--on-demand]\n"
+        << "                   [--bench] [--bench-params k=v,...] [--bench-sweep k=v1,v2,...] [--bench-csv FILE]\n"
+        << "Benchmark params: trees, bushes, lights, meshes, materials, targets, deferred" << std::endl;
+}
+
+static RunOptions parseOptions(int argc, char** argv) {
+    RunOptions options;
+    int warmup = -1;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        auto value = [&]() -> const char* {
+            if (i + 1 >= argc) throw std::runtime_error(std::string("Missing value for ") + arg);
+            return argv[++i];
+        };
+
+        if (std::strcmp(arg, "--headless") == 0) options.headless = true;
+        else if (std::strcmp(arg, "--scene") == 0) options.scene = std::atoi(value());
+        else if (std::strcmp(arg, "--frames") == 0) options.frames = std::atoi(value());
+        else if (std::strcmp(arg, "--duration") == 0) options.duration = std::atof(value());
+        else if (std::strcmp(arg, "--frame-log") == 0) options.frameLog = value();
+        else if (std::strcmp(arg, "--record") == 0) options.recordPath = value();
+        else if (std::strcmp(arg, "--replay") == 0) options.replayPath = value();
+        else if (std::strcmp(arg, "--seed") == 0) {
+            options.seed = (unsigned int)std::strtoul(value(), nullptr, 10);
+            options.hasSeed = true;
+        }
+        else if (std::strcmp(arg, "--warmup") == 0) warmup = std::atoi(value());
+        else if (std::strcmp(arg, "--trace") == 0) options.tracePath = value();
+        else if (std::strcmp(arg, "--gpu-draw-zones") == 0) options.gpuDrawZones = true;
+        else if (std::strcmp(arg, "--stats-interval") == 0) options.statsInterval = std::atof(value());
+        else if (std::strcmp(arg, "--metrics") == 0) options.metricsPath = value();
+        else if (std::strcmp(arg, "--dynamic-res") == 0) options.dynamicResTarget = std::atof(value());
+        else if (std::strcmp(arg, "--min-scale") == 0) options.dynamicResMinScale = (float)std::atof(value());
+        else if (std::strcmp(arg, "--on-demand") == 0) options.onDemand = true;
+        else if (std::strcmp(arg, "--bench") == 0) options.benchmark = true;
+        else if (std::strcmp(arg, "--bench-params") == 0) {
+            options.benchParams.parse(value());
+            options.benchmark = true;
+        }
+        else if (std::strcmp(arg, "--bench-sweep") == 0) {
+            options.benchSweeps.push_back(BenchmarkSweep::parse(value()));
+            options.benchmark = true;
+        }
+        else if (std::strcmp(arg, "--bench-csv") == 0) {
+            options.benchCsv = value();
+            options.benchmark = true;
+        }
+        else {
+            printUsage();
+            throw std::runtime_error(std::string("Unknown argument: ") + arg);
+        }
+    }
+
+    if (!options.recordPath.empty() && !options.replayPath.empty()) {
+        throw std::runtime_error("--record and --replay cannot be combined");
+    }
+    if (options.benchmark && (!options.recordPath.empty() || !options.replayPath.empty())) {
+        throw std::runtime_error("--bench cannot be combined with --record or --replay");
+    }
+
+    if (options.benchmark) {
+        // Kazda konfigurace bezi stejne dlouho, jinak se radky CSV nedaji porovnat
+        if (options.frames <= 0 && options.duration <= 0.0) options.frames = 300;
+        if (warmup < 0) warmup = 30;
+    }
+    options.warmupFrames = std::max(warmup, 0);
+
+    // Headless beh nejde zavrit klavesou, bez limitu by nikdy neskoncil (prehravani konci samo)
+    if (options.headless && options.frames <= 0 && options.duration <= 0.0 && options.replayPath.empty()) {
+        options.frames = 600;
+    }
+    return options;
+}
+
+int main(int argc, char** argv) {
     try {
-        Application app(1024, 728, "OpenGL Scenes");
+        RunOptions options = parseOptions(argc, argv);
+        Application app(1024, 728, "OpenGL Scenes", options);
         app.start();
     }
     catch (const std::exception& e) {
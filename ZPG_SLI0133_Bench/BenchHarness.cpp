@@ -0,0 +1,335 @@
+#include "BenchHarness.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+    std::vector<std::unique_ptr<Benchmark>>& registry() {
+        static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+        return benchmarks;
+    }
+
+    int64_t realNow() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Cas procesu; na Windows clock() meri realny cas od startu
+    int64_t cpuNow() {
+        return (int64_t)((double)std::clock() * 1e9 / CLOCKS_PER_SEC);
+    }
+
+    std::string jsonEscape(const std::string& text) {
+        std::string out;
+        for (char c : text) {
+            if (c == '"' || c == '\\') out += '\\';
+            out += c;
+        }
+        return out;
+    }
+}
+
+void benchUseCharPointer(const volatile char*) {
+}
+
+BenchState::BenchState(int64_t maxIterations, const std::vector<int64_t>& args)
+    : m_MaxIterations(maxIterations), m_Args(args) {
+    m_Args.resize(std::max<size_t>(m_Args.size(), 1), 0);
+}
+
+void BenchState::startTimer() {
+    m_Running = true;
+    m_RealStart = realNow();
+    m_CpuStart = cpuNow();
+}
+
+void BenchState::stopTimer() {
+    if (!m_Running) return;
+    m_Running = false;
+    m_RealTime += (double)(realNow() - m_RealStart) * 1e-9;
+    m_CpuTime += (double)(cpuNow() - m_CpuStart) * 1e-9;
+}
+
+void BenchState::pauseTiming() {
+    stopTimer();
+}
+
+void BenchState::resumeTiming() {
+    startTimer();
+}
+
+void BenchState::finish() {
+    stopTimer();
+    m_Finished = true;
+}
+
+Benchmark::Benchmark(const char* name, BenchFunction function)
+    : m_Name(name), m_Function(function) {
+}
+
+Benchmark* Benchmark::arg(int64_t value) {
+    m_Args.push_back({ value });
+    return this;
+}
+
+Benchmark* Benchmark::args(std::initializer_list<int64_t> values) {
+    m_Args.push_back(std::vector<int64_t>(values));
+    return this;
+}
+
+Benchmark* Benchmark::range(int64_t lo, int64_t hi) {
+    for (int64_t value = lo; value < hi; value *= 8) {
+        arg(value);
+    }
+    return arg(hi);
+}
+
+Benchmark* registerBenchmark(const char* name, BenchFunction function) {
+    registry().push_back(std::unique_ptr<Benchmark>(new Benchmark(name, function)));
+    return registry().back().get();
+}
+
+struct BenchResult {
+    std::string name;
+    int64_t iterations = 0;
+    double realTime = 0.0; // ns na iteraci
+    double cpuTime = 0.0;
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    std::string label;
+    std::string error;
+};
+
+class BenchRunner {
+public:
+    static const int64_t MAX_ITERATIONS = 1000000000;
+
+    explicit BenchRunner(double minTime) : m_MinTime(minTime) {}
+
+    BenchResult run(const Benchmark& benchmark, const std::vector<int64_t>& args, const std::string& name) const {
+        BenchResult result;
+        result.name = name;
+
+        int64_t iterations = 1;
+        for (;;) {
+            BenchState state(iterations, args);
+            benchmark.getFunction()(state);
+
+            if (!state.m_Error.empty()) {
+                result.error = state.m_Error;
+                return result;
+            }
+            if (!state.m_Finished) {
+                result.error = "benchmark skoncil pred koncem smycky keepRunning()";
+                return result;
+            }
+
+            // Stejny odhad jako Google Benchmark: mirit na 1.4x min time, nejvys 10x vic iteraci
+            if (state.m_RealTime >= m_MinTime || iterations >= MAX_ITERATIONS) {
+                const double seconds = std::max(state.m_RealTime, 1e-12);
+                result.iterations = iterations;
+                result.realTime = state.m_RealTime * 1e9 / (double)iterations;
+                result.cpuTime = state.m_CpuTime * 1e9 / (double)iterations;
+                result.itemsPerSecond = (double)state.m_Items / seconds;
+                result.bytesPerSecond = (double)state.m_Bytes / seconds;
+                result.label = state.m_Label;
+                return result;
+            }
+
+            double multiplier = state.m_RealTime > 1e-9 ? m_MinTime * 1.4 / state.m_RealTime : 10.0;
+            multiplier = std::min(multiplier, 10.0);
+            int64_t next = (int64_t)std::ceil((double)iterations * multiplier);
+            iterations = std::min(std::max(next, iterations + 1), MAX_ITERATIONS);
+        }
+    }
+
+private:
+    double m_MinTime;
+};
+
+namespace {
+    std::string formatRate(double perSecond, const char* unit) {
+        const char* prefixes[] = { "", "k", "M", "G", "T" };
+        int prefix = 0;
+        while (perSecond >= 1000.0 && prefix < 4) {
+            perSecond /= 1000.0;
+            ++prefix;
+        }
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2) << perSecond << prefixes[prefix] << unit;
+        return out.str();
+    }
+
+    void printConsole(const std::vector<BenchResult>& results, std::ostream& out) {
+        size_t nameWidth = 10;
+        for (const BenchResult& result : results) {
+            nameWidth = std::max(nameWidth, result.name.size() + 2);
+        }
+
+        out << std::left << std::setw((int)nameWidth) << "Benchmark" << std::right
+            << std::setw(15) << "Time [ns]" << std::setw(15) << "CPU [ns]" << std::setw(13) << "Iterations" << "\n"
+            << std::string(nameWidth + 43, '-') << "\n";
+        for (const BenchResult& result : results) {
+            out << std::left << std::setw((int)nameWidth) << result.name << std::right;
+            if (!result.error.empty()) {
+                out << "ERROR: " << result.error << "\n";
+                continue;
+            }
+            out << std::fixed << std::setprecision(1)
+                << std::setw(15) << result.realTime << std::setw(15) << result.cpuTime
+                << std::setw(13) << result.iterations << std::defaultfloat;
+            if (result.itemsPerSecond > 0.0) out << " " << formatRate(result.itemsPerSecond, " items/s");
+            if (result.bytesPerSecond > 0.0) out << " " << formatRate(result.bytesPerSecond, "B/s");
+            if (!result.label.empty()) out << " " << result.label;
+            out << "\n";
+        }
+        out << std::flush;
+    }
+
+    void printJson(const std::vector<BenchResult>& results, const std::string& executable, std::ostream& out) {
+        char date[64] = {};
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"executable\": \"" << jsonEscape(executable) << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#ifdef NDEBUG
+            << "    \"library_build_type\": \"release\"\n"
+#else
+            << "    \"library_build_type\": \"debug\"\n"
+#endif
+            << "  },\n  \"benchmarks\": [";
+
+        bool first = true;
+        for (const BenchResult& result : results) {
+            out << (first ? "\n" : ",\n") << "    {\n"
+                << "      \"name\": \"" << jsonEscape(result.name) << "\",\n"
+                << "      \"run_name\": \"" << jsonEscape(result.name) << "\",\n"
+                << "      \"run_type\": \"iteration\",\n";
+            first = false;
+            if (!result.error.empty()) {
+                out << "      \"error_occurred\": true,\n"
+                    << "      \"error_message\": \"" << jsonEscape(result.error) << "\"\n    }";
+                continue;
+            }
+            out << "      \"iterations\": " << result.iterations << ",\n"
+                << std::setprecision(10)
+                << "      \"real_time\": " << result.realTime << ",\n"
+                << "      \"cpu_time\": " << result.cpuTime << ",\n"
+                << "      \"time_unit\": \"ns\"";
+            if (result.itemsPerSecond > 0.0) out << ",\n      \"items_per_second\": " << result.itemsPerSecond;
+            if (result.bytesPerSecond > 0.0) out << ",\n      \"bytes_per_second\": " << result.bytesPerSecond;
+            if (!result.label.empty()) out << ",\n      \"label\": \"" << jsonEscape(result.label) << "\"";
+            out << "\n    }";
+        }
+        out << "\n  ]\n}\n" << std::flush;
+    }
+
+    bool readFlag(const std::string& argument, const char* flag, std::string& value) {
+        const std::string prefix = std::string(flag) + "=";
+        if (argument.compare(0, prefix.size(), prefix) != 0) return false;
+        value = argument.substr(prefix.size());
+        return true;
+    }
+
+    void printUsage() {
+        std::cout << "Pouziti: ZPG_SLI0133_Bench [moznosti]\n"
+            << "  --benchmark_filter=REGEX   jen benchmarky, jejichz nazev odpovida\n"
+            << "  --benchmark_min_time=S     minimalni doba mereni jednoho benchmarku (vychozi 0.5)\n"
+            << "  --benchmark_out=FILE       JSON s vysledky (baseline pro porovnani)\n"
+            << "  --benchmark_format=F       console nebo json na stdout\n"
+            << "  --benchmark_list_tests     jen vypise nazvy\n"
+            << "Assety se ctou z assets/ v pracovnim adresari (ZPG_SLI0133/).\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    std::string filter = ".";
+    std::string outPath;
+    std::string format = "console";
+    double minTime = 0.5;
+    bool listOnly = false;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string argument = argv[i];
+            std::string value;
+            if (readFlag(argument, "--benchmark_filter", value)) filter = value;
+            else if (readFlag(argument, "--benchmark_out", value)) outPath = value;
+            else if (readFlag(argument, "--benchmark_format", value)) format = value;
+            else if (readFlag(argument, "--benchmark_min_time", value)) minTime = std::stod(value);
+            else if (argument == "--benchmark_list_tests") listOnly = true;
+            else if (argument == "--help" || argument == "-h") {
+                printUsage();
+                return 0;
+            }
+            else throw std::runtime_error("Neznama volba: " + argument);
+        }
+        if (format != "console" && format != "json") {
+            throw std::runtime_error("Neznamy format: " + format);
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    const std::regex pattern(filter);
+    const BenchRunner runner(minTime);
+    std::vector<BenchResult> results;
+
+    // Logy enginu (Model, tinyobj) behem mereni na stderr, stdout jen pro vysledky
+    std::streambuf* stdoutBuffer = std::cout.rdbuf();
+    if (!listOnly) std::cout.rdbuf(std::cerr.rdbuf());
+
+    for (const auto& benchmark : registry()) {
+        std::vector<std::vector<int64_t>> argSets = benchmark->getArgs();
+        const bool hasArgs = !argSets.empty();
+        if (!hasArgs) argSets.push_back(std::vector<int64_t>());
+
+        for (const std::vector<int64_t>& args : argSets) {
+            std::string name = benchmark->getName();
+            for (int64_t value : args) name += "/" + std::to_string(value);
+            if (!std::regex_search(name, pattern)) continue;
+
+            if (listOnly) {
+                std::cout << name << "\n";
+                continue;
+            }
+            results.push_back(runner.run(*benchmark, args, name));
+            if (format == "console") {
+                // Prubezne, mereni trva
+                std::cerr << "." << std::flush;
+            }
+        }
+    }
+    std::cout.rdbuf(stdoutBuffer);
+    if (listOnly) return 0;
+    if (format == "console") std::cerr << "\n";
+
+    if (format == "json") printJson(results, argv[0], std::cout);
+    else printConsole(results, std::cout);
+
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        if (!out) {
+            std::cerr << "Nelze zapsat " << outPath << std::endl;
+            return 1;
+        }
+        printJson(results, argv[0], out);
+        std::cerr << "Vysledky zapsany do " << outPath << std::endl;
+    }
+    return 0;
+}
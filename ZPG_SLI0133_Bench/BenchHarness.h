@@ -0,0 +1,103 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Maly harness ve stylu Google Benchmark (bez zavislosti). Benchmark je funkce
+// void(BenchState&), ktera meri telo smycky while (state.keepRunning()).
+// Pocet iteraci se zvysuje, dokud mereni netrva aspon --benchmark_min_time.
+// JSON vystup (--benchmark_out) ma stejny format jako Google Benchmark,
+// takze jde porovnat jeho tools/compare.py nebo obycejnym diffem.
+class BenchState {
+public:
+    BenchState(int64_t maxIterations, const std::vector<int64_t>& args);
+
+    bool keepRunning() {
+        if (m_Iterations < m_MaxIterations && m_Error.empty()) {
+            if (m_Iterations++ == 0) startTimer();
+            return true;
+        }
+        finish();
+        return false;
+    }
+
+    int64_t range(size_t index = 0) const { return m_Args[index]; }
+    int64_t iterations() const { return m_Iterations; }
+
+    // Priprava dat uvnitr smycky, ktera se nema pocitat
+    void pauseTiming();
+    void resumeTiming();
+
+    void setItemsProcessed(int64_t items) { m_Items = items; }
+    void setBytesProcessed(int64_t bytes) { m_Bytes = bytes; }
+    void setLabel(const std::string& label) { m_Label = label; }
+    // Benchmark se nezmeri a ve vystupu bude s chybou (napr. chybejici asset)
+    void skipWithError(const std::string& error) { m_Error = error; }
+
+private:
+    friend class BenchRunner;
+
+    void startTimer();
+    void stopTimer();
+    void finish();
+
+    int64_t m_MaxIterations;
+    int64_t m_Iterations = 0;
+    std::vector<int64_t> m_Args;
+    bool m_Running = false;
+    bool m_Finished = false;
+    double m_RealTime = 0.0; // s
+    double m_CpuTime = 0.0;
+    int64_t m_RealStart = 0;
+    int64_t m_CpuStart = 0;
+
+    int64_t m_Items = 0;
+    int64_t m_Bytes = 0;
+    std::string m_Label;
+    std::string m_Error;
+};
+
+typedef void (*BenchFunction)(BenchState&);
+
+class Benchmark {
+public:
+    Benchmark(const char* name, BenchFunction function);
+
+    Benchmark* arg(int64_t value);
+    Benchmark* args(std::initializer_list<int64_t> values);
+    // lo, lo*8, lo*64, ..., hi (jako Range v Google Benchmark)
+    Benchmark* range(int64_t lo, int64_t hi);
+
+    const std::string& getName() const { return m_Name; }
+    BenchFunction getFunction() const { return m_Function; }
+    const std::vector<std::vector<int64_t>>& getArgs() const { return m_Args; }
+
+private:
+    std::string m_Name;
+    BenchFunction m_Function;
+    std::vector<std::vector<int64_t>> m_Args;
+};
+
+Benchmark* registerBenchmark(const char* name, BenchFunction function);
+
+// Vysledek nesmi optimalizator zahodit
+void benchUseCharPointer(const volatile char* pointer);
+
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(_MSC_VER)
+    benchUseCharPointer(&reinterpret_cast<const volatile char&>(value));
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+#define ZPG_BENCH_CONCAT_(a, b) a##b
+#define ZPG_BENCH_CONCAT(a, b) ZPG_BENCH_CONCAT_(a, b)
+#define ZPG_BENCHMARK(function) \
+    static Benchmark* ZPG_BENCH_CONCAT(zpgBenchmark, __LINE__) = registerBenchmark(#function, function)
@@ -0,0 +1,275 @@
+#include "BenchHarness.h"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+#include "DrawableObject.h"
+#include "LightGrid.h"
+#include "LightStorage.h"
+#include "Model.h"
+#include "NullRenderDevice.h"
+#include "ObjectStorage.h"
+#include "SceneArena.h"
+#include "ShaderProgram.h"
+#include "TransformationComposite.h"
+#include "stb_image.h"
+
+// CPU hot paths enginu bez GL kontextu. Cesty k assetum jsou relativni
+// k ZPG_SLI0133/ (pracovni adresar aplikace).
+
+namespace {
+    const char* const OBJ_FILES[] = {
+        "assets/cube.obj",
+        "assets/sphere.obj",
+        "assets/sky/skydome.obj",
+        "assets/teren/teren.obj",
+        "assets/shrek/shrek.obj",
+        "assets/shrek/fiona.obj",
+        "assets/house.obj",
+    };
+
+    const char* const TEXTURE_FILES[] = {
+        "assets/multipletexture/mud.jpg",
+        "assets/cubemap/posx.jpg",
+        "assets/texture/2k_earth_daymap.jpg",
+        "assets/shrek/toiled.jpg",
+        "assets/sky/skydome.png",
+        "assets/multipletexture/grass.png",
+    };
+
+    // Jeden trojuhelnik (pozice + normala, stride 6) pro Model na NullRenderDevice
+    const float TRIANGLE[] = {
+        0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+        0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f,
+    };
+
+    bool readFile(const char* path, std::vector<unsigned char>& data) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) return false;
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    // Stejne jako Scene::getObjectByID
+    DrawableObject getObjectByID(ObjectStorage& objects, unsigned int id) {
+        if (objects.indexOf(id) == ObjectStorage::INVALID_INDEX) {
+            return DrawableObject();
+        }
+        return DrawableObject(objects, id);
+    }
+
+    void fillPointLights(LightStorage& lights, int count, float fieldSize) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> position(-fieldSize * 0.5f, fieldSize * 0.5f);
+        std::uniform_real_distribution<float> color(0.2f, 1.0f);
+        for (int i = 0; i < count; ++i) {
+            lights.addPointLight(PointLight(glm::vec3(position(rng), 1.0f, position(rng)),
+                glm::vec3(color(rng), color(rng), color(rng))));
+        }
+    }
+}
+
+// Retezec transformaci objektu: translate/rotate/scale dokola; nad MAX_STEPS se
+// zacatek retezce slozi do jedne matice
+static void BM_TransformationGetMatrix(BenchState& state) {
+    TransformationComposite transformation;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        switch (i % 3) {
+        case 0: transformation.translate(glm::vec3(0.5f, 0.0f, -0.25f)); break;
+        case 1: transformation.rotate(0.1f, glm::vec3(0.0f, 1.0f, 0.0f)); break;
+        default: transformation.scale(glm::vec3(1.01f)); break;
+        }
+    }
+
+    while (state.keepRunning()) {
+        glm::mat4 matrix = transformation.getMatrix();
+        doNotOptimize(matrix);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+ZPG_BENCHMARK(BM_TransformationGetMatrix)->arg(1)->arg(3)->arg(8)->arg(16)->arg(64);
+
+// Model::Model(const char*) bez uploadu: tinyobj parse a rozvinuti indexu
+static void BM_ObjLoad(BenchState& state) {
+    const char* path = OBJ_FILES[state.range(0)];
+    state.setLabel(path);
+    if (!std::ifstream(path)) {
+        state.skipWithError(std::string("chybi ") + path);
+        return;
+    }
+
+    std::vector<float> vertices;
+    while (state.keepRunning()) {
+        Model::loadObjVertices(path, vertices);
+        doNotOptimize(vertices.data());
+    }
+    state.setBytesProcessed(state.iterations() * (int64_t)(vertices.size() * sizeof(float)));
+}
+ZPG_BENCHMARK(BM_ObjLoad)->arg(0)->arg(1)->arg(2)->arg(3)->arg(4)->arg(5)->arg(6);
+
+// Dekodovani textury z pameti (TextureLoader::LoadTexture bez cteni souboru a uploadu)
+static void BM_TextureDecode(BenchState& state) {
+    const char* path = TEXTURE_FILES[state.range(0)];
+    state.setLabel(path);
+    std::vector<unsigned char> file;
+    if (!readFile(path, file)) {
+        state.skipWithError(std::string("chybi ") + path);
+        return;
+    }
+
+    stbi_set_flip_vertically_on_load(true);
+    int64_t decoded = 0;
+    while (state.keepRunning()) {
+        int width, height, channels;
+        unsigned char* data = stbi_load_from_memory(file.data(), (int)file.size(), &width, &height, &channels, 0);
+        if (!data) {
+            state.skipWithError(std::string("stb: ") + stbi_failure_reason());
+            break;
+        }
+        doNotOptimize(data[0]);
+        decoded += (int64_t)width * height * channels;
+        stbi_image_free(data);
+    }
+    state.setBytesProcessed(decoded);
+}
+ZPG_BENCHMARK(BM_TextureDecode)->arg(0)->arg(1)->arg(2)->arg(3)->arg(4)->arg(5);
+
+// Puvodni setLights plnilo uniformy po svetlech; ted LightStorage::upload kopiruje
+// pole primo do UBO. Meri se stejne kopirovani do obrazu bloku v pameti.
+static void BM_LightBlockPack(BenchState& state) {
+    LightStorage lights;
+    fillPointLights(lights, (int)state.range(0), 100.0f);
+    lights.addDirLight(DirLight(glm::vec3(-0.2f, -1.0f, -0.3f), glm::vec3(0.3f)));
+
+    // Stejne offsety jako LightStorage::upload (glBufferSubData)
+    std::vector<unsigned char> block(sizeof(LightBlock));
+    const glm::vec4 ambient(0.1f, 0.1f, 0.1f, 0.0f);
+    const SpotLight flashlight(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(1.0f),
+        1.0f, 0.09f, 0.032f, 0.97f, 0.95f);
+    while (state.keepRunning()) {
+        std::memcpy(&block[offsetof(LightBlock, ambient)], &ambient, sizeof(glm::vec4));
+        std::memcpy(&block[offsetof(LightBlock, flashlight)], &flashlight, sizeof(SpotLight));
+        std::memcpy(&block[offsetof(LightBlock, dirLights)], lights.getDirLights().data(),
+            lights.getDirLightCount() * sizeof(DirLight));
+        std::memcpy(&block[offsetof(LightBlock, pointLights)], lights.getPointLights().data(),
+            lights.getPointLightCount() * sizeof(PointLight));
+        doNotOptimize(block.data());
+    }
+    state.setBytesProcessed(state.iterations() * (int64_t)(sizeof(glm::vec4) + sizeof(SpotLight)
+        + lights.getDirLightCount() * sizeof(DirLight) + lights.getPointLightCount() * sizeof(PointLight)));
+}
+ZPG_BENCHMARK(BM_LightBlockPack)->arg(16)->arg(64)->arg(256);
+
+// Prestaveni mrizky svetel (jednou za snimek)
+static void BM_LightGridBuild(BenchState& state) {
+    LightStorage lights;
+    fillPointLights(lights, (int)state.range(0), 100.0f);
+
+    LightGrid grid;
+    while (state.keepRunning()) {
+        grid.build(lights.getPointLights(), lights.getPointLightCount());
+        doNotOptimize(grid);
+    }
+    state.setItemsProcessed(state.iterations() * lights.getPointLightCount());
+}
+ZPG_BENCHMARK(BM_LightGridBuild)->arg(16)->arg(64)->arg(256);
+
+// Vyber svetel pro objekty rozmistene po stejnem poli (forward pass, za objekt)
+static void BM_LightGridSelect(BenchState& state) {
+    LightStorage lights;
+    fillPointLights(lights, (int)state.range(0), 100.0f);
+    LightGrid grid;
+    grid.build(lights.getPointLights(), lights.getPointLightCount());
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+    std::vector<Bounds> objects(1024);
+    for (Bounds& bounds : objects) {
+        bounds.center = glm::vec3(position(rng), 0.5f, position(rng));
+        bounds.radius = 1.0f;
+    }
+
+    size_t next = 0;
+    while (state.keepRunning()) {
+        LightGrid::Selection selection = grid.select(objects[next]);
+        doNotOptimize(selection);
+        next = (next + 1) & (objects.size() - 1);
+    }
+    state.setItemsProcessed(state.iterations());
+}
+ZPG_BENCHMARK(BM_LightGridSelect)->arg(16)->arg(64)->arg(256);
+
+// Scene::getObjectByID a pristup k transformaci, jak to dela update (orbitery, cile).
+// Scena potrebuje GL, meri se primo ObjectStorage s meshem na NullRenderDevice.
+static void BM_GetObjectByID(BenchState& state) {
+    const unsigned int count = (unsigned int)state.range(0);
+    NullRenderDevice device;
+    RenderDevice::set(&device);
+    {
+        ObjectStorage objects;
+        const MeshHandle mesh = objects.addMesh(makeArenaPtr<Model>(nullptr, TRIANGLE, sizeof(TRIANGLE), 6));
+
+        for (unsigned int id = 1; id <= count; ++id) {
+            objects.create(id, mesh);
+            objects.getTransformation(objects.indexOf(id)).translate(glm::vec3((float)id, 0.0f, 0.0f));
+        }
+        // Jako po mazani ve hre: husty index uz neodpovida poradi ID
+        for (unsigned int id = 1; id <= count; id += 3) {
+            objects.destroy(id);
+        }
+
+        std::mt19937 rng(3);
+        std::uniform_int_distribution<unsigned int> idDistribution(1, count);
+        std::vector<unsigned int> lookups(4096);
+        for (unsigned int& id : lookups) id = idDistribution(rng);
+
+        size_t next = 0;
+        while (state.keepRunning()) {
+            DrawableObject object = getObjectByID(objects, lookups[next]);
+            if (object) {
+                doNotOptimize(&object.getTransformation());
+            }
+            next = (next + 1) & (lookups.size() - 1);
+        }
+        state.setItemsProcessed(state.iterations());
+    }
+    RenderDevice::set(nullptr);
+}
+ZPG_BENCHMARK(BM_GetObjectByID)->arg(1000)->arg(10000)->arg(100000);
+
+// CPU cena odeslani objektu jako ve Scene::drawObject (uniformy + Model::draw)
+// na NullRenderDevice: ShaderProgram a Model bez GL, cista cena cesty enginu
+static void BM_DrawSubmit(BenchState& state) {
+    const char* vertexShader = "basic_vertexShader.vert";
+    const char* fragmentShader = "basic_Phong_fragmentShader.frag";
+    if (!std::ifstream(vertexShader) || !std::ifstream(fragmentShader)) {
+        state.skipWithError("chybi shadery v pracovnim adresari");
+        return;
+    }
+
+    NullRenderDevice device;
+    RenderDevice::set(&device);
+    {
+        Model model(TRIANGLE, sizeof(TRIANGLE), 6);
+        ShaderProgram program(vertexShader, fragmentShader);
+        const glm::mat4 modelMatrix(1.0f);
+        const glm::mat3 normalMatrix(1.0f);
+        const int64_t objects = state.range(0);
+
+        while (state.keepRunning()) {
+            program.use();
+            for (int64_t i = 0; i < objects; ++i) {
+                program.setMat4("u_ModelMatrix", modelMatrix);
+                program.setMat3("u_NormalMatrix", normalMatrix);
+                model.draw();
+            }
+        }
+        state.setItemsProcessed(state.iterations() * objects);
+    }
+    RenderDevice::set(nullptr);
+}
+ZPG_BENCHMARK(BM_DrawSubmit)->arg(100)->arg(1000)->arg(10000);